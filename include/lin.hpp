@@ -6,10 +6,13 @@
 #ifndef LIN_HPP_
 #define LIN_HPP_
 
+#include "lin/batch.hpp"
 #include "lin/core.hpp"
+#include "lin/dynamic.hpp"
 #include "lin/factorizations.hpp"
 #include "lin/generators.hpp"
 #include "lin/math.hpp"
+#include "lin/parallel.hpp"
 #include "lin/queries.hpp"
 #include "lin/references.hpp"
 #include "lin/substitutions.hpp"
@@ -0,0 +1,127 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+//
+// MIT License
+//
+// Copyright (c) 2020 kylekrol
+// Copyright (c) 2020 Pathfinder for Autonomous Navigation (PAN)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/** @file lin/batch.hpp
+ *  @author Kyle Krol
+ */
+
+/** @defgroup BATCH Batch
+ *
+ *  @brief Evaluates the same small problem for many independent inputs at
+ *         once.
+ *
+ *  Operations on a single three by three matrix are too small to vectorize
+ *  well. When the same operation is applied to thousands of independent
+ *  problems, such as per particle states, lin::Batch instead stores element
+ *  `(i, j)` of every problem contiguously and each operation is vectorized
+ *  across the problems.
+ *
+ *  A batch is an ordinary lin tensor whose elements are lin::Lanes, so the
+ *  entire expression API applies as is. Individual problems are scattered into
+ *  and gathered out of a batch with lin::lane:
+ *
+ *  ~~~{.cpp}
+ *  #include <lin/batch.hpp>
+ *  #include <lin/core.hpp>
+ *  #include <lin/factorizations.hpp>
+ *
+ *  void solve(lin::Matrix3x3d const *A, lin::Vector3d const *b, lin::Vector3d *x) {
+ *    lin::Batch<lin::Matrix3x3d, 8> L;
+ *    lin::Batch<lin::Vector3d, 8> y;
+ *    for (lin::size_t k = 0; k < 8; k++) {
+ *      lin::lane(L, k) = A[k];
+ *      lin::lane(y, k) = b[k];
+ *    }
+ *
+ *    lin::chol(L);
+ *    // ...
+ *
+ *    for (lin::size_t k = 0; k < 8; k++) x[k] = lin::lane(y, k);
+ *  }
+ *  ~~~
+ *
+ *  Operations branching on element values, such as those in the math and
+ *  queries modules, aren't supported on batches.
+ */
+
+#ifndef LIN_BATCH_HPP_
+#define LIN_BATCH_HPP_
+
+#include "core.hpp"
+#include "batch/batch.hpp"
+#include "batch/lane_mapping_reference.hpp"
+#include "batch/lane_stream_reference.hpp"
+#include "batch/lanes.hpp"
+
+#include <type_traits>
+
+namespace lin {
+
+/** @brief Creates a reference to a single problem of a batch with read and
+ *         write access.
+ *
+ *  @tparam D Underlying batch type.
+ *
+ *  @param mapping Underlying batch.
+ *  @param k       Lane index.
+ *
+ *  @return Instance of an internal::LaneMappingReference.
+ *
+ *  Assigning a tensor to the reference scatters it into lane `k` of the batch.
+ *
+ *  @sa Batch
+ *
+ *  @ingroup BATCH
+ */
+template <class D, typename = std::enable_if_t<internal::is_batch<D>::value>>
+constexpr auto lane(internal::Mapping<D> &mapping, size_t k) {
+  return internal::LaneMappingReference<D>(mapping, k);
+}
+
+/** @brief Creates a reference to a single problem of a batch with read only
+ *         access.
+ *
+ *  @tparam D Underlying batch type.
+ *
+ *  @param stream Underlying batch.
+ *  @param k      Lane index.
+ *
+ *  @return Instance of an internal::LaneStreamReference.
+ *
+ *  Evaluating the reference gathers lane `k` of the batch.
+ *
+ *  @sa Batch
+ *
+ *  @ingroup BATCH
+ */
+template <class D, typename = std::enable_if_t<internal::is_batch<D>::value>>
+constexpr auto lane(internal::Stream<D> const &stream, size_t k) {
+  return internal::LaneStreamReference<D>(stream, k);
+}
+}  // namespace lin
+
+#endif
@@ -0,0 +1,68 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/batch/batch.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_BATCH_BATCH_HPP_
+#define LIN_BATCH_BATCH_HPP_
+
+#include "../core.hpp"
+#include "lanes.hpp"
+
+namespace lin {
+namespace internal {
+
+template <class M, size_t N>
+struct _batch;
+
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class S, size_t N>
+struct _batch<Matrix<T, R, C, MR, MC, S>, N> {
+  typedef Matrix<Lanes<T, N>, R, C, MR, MC, S> type;
+};
+
+template <typename T, size_t R, size_t MR, class S, size_t N>
+struct _batch<Vector<T, R, MR, S>, N> {
+  typedef Vector<Lanes<T, N>, R, MR, S> type;
+};
+
+template <typename T, size_t C, size_t MC, class S, size_t N>
+struct _batch<RowVector<T, C, MC, S>, N> {
+  typedef RowVector<Lanes<T, N>, C, MC, S> type;
+};
+}  // namespace internal
+
+/** @brief Structure of arrays container for many problems of the same type.
+ *
+ *  @tparam M Matrix, Vector, or RowVector type of a single problem.
+ *  @tparam N Number of problems in the batch.
+ *
+ *  A batch is the tensor type `M` with each scalar element replaced by
+ *  lin::Lanes holding that element for every problem. Element `(i, j)` of all
+ *  `N` problems is therefore stored contiguously and every expression over
+ *  batches, including matrix products, lin::dot, lin::cross, lin::norm,
+ *  lin::chol, and the substitutions, is evaluated for all problems at once
+ *  with the per element work vectorized across the batch.
+ *
+ *  ~~~{.cpp}
+ *  lin::Batch<lin::Matrix3x3d, 8> A;
+ *  lin::Batch<lin::Vector3d, 8> x;
+ *  for (std::size_t k = 0; k < 8; k++) {
+ *    lin::lane(A, k) = rotations[k];
+ *    lin::lane(x, k) = positions[k];
+ *  }
+ *  lin::Batch<lin::Vector3d, 8> y = A * x;
+ *  lin::Vector3d y3 = lin::lane(y, 3);
+ *  ~~~
+ *
+ *  @sa Lanes
+ *  @sa lane
+ *
+ *  @ingroup BATCH
+ */
+template <class M, size_t N>
+using Batch = typename internal::_batch<M, N>::type;
+
+}  // namespace lin
+
+#endif
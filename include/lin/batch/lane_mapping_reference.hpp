@@ -0,0 +1,147 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/batch/lane_mapping_reference.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_BATCH_LANE_MAPPING_REFERENCE_HPP_
+#define LIN_BATCH_LANE_MAPPING_REFERENCE_HPP_
+
+#include "../core.hpp"
+#include "lanes.hpp"
+
+namespace lin {
+namespace internal {
+
+/** @brief Reference to a single problem of a batch with read and write
+ *         access.
+ *
+ *  @tparam E Underlying batch type.
+ *
+ *  Exposes one lane of every element of a batch as an ordinary tensor with
+ *  the batch's dimensions. Assigning to the reference scatters a problem into
+ *  the batch and evaluating it gathers the problem back out.
+ *
+ *  It's important to note, if the underlying mapping goes out of scope the
+ *  reference is invalidated.
+ *
+ *  @sa internal::LaneStreamReference
+ *  @sa Batch
+ *
+ *  @ingroup BATCH
+ */
+template <class E>
+class LaneMappingReference : public Mapping<LaneMappingReference<E>> {
+  static_assert(is_batch<E>::value,
+      "Underlying mapping for a lane reference must be a batch.");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef traits<LaneMappingReference<E>> Traits;
+
+ private:
+  Mapping<E> &_mapping;
+  size_t const _lane;
+
+ protected:
+  using Mapping<LaneMappingReference<E>>::derived;
+
+ public:
+  using Mapping<LaneMappingReference<E>>::size;
+  using Mapping<LaneMappingReference<E>>::eval;
+  using Mapping<LaneMappingReference<E>>::operator();
+  using Mapping<LaneMappingReference<E>>::operator=;
+
+  constexpr LaneMappingReference() = delete;
+  constexpr LaneMappingReference(LaneMappingReference<E> const &) = default;
+  constexpr LaneMappingReference(LaneMappingReference<E> &&) = default;
+  constexpr LaneMappingReference<E> &operator=(LaneMappingReference<E> const &) = default;
+  constexpr LaneMappingReference<E> &operator=(LaneMappingReference<E> &&) = default;
+
+  /** @brief Constructs a new lane reference with the provided mapping.
+   *
+   *  @param mapping Underlying batch.
+   *  @param k       Lane index.
+   *
+   *  The lane index must be less than the batch's width or lin assertion
+   *  errors will be triggered.
+   */
+  constexpr LaneMappingReference(Mapping<E> &mapping, size_t k)
+  : _mapping(mapping), _lane(k) {
+    LIN_ASSERT(k < _elem_t<E>::width);
+  }
+
+  /** @return Number of rows.
+   */
+  constexpr size_t rows() const {
+    return _mapping.rows();
+  }
+
+  /** @return Number of columns.
+   */
+  constexpr size_t cols() const {
+    return _mapping.cols();
+  }
+
+  /** @brief Provides read and write access to tensor elements.
+   *
+   *  @param i Row index.
+   *  @param j Column index.
+   *
+   *  @return Reference to the referenced lane of the batch element.
+   *
+   *  If the indices are out of bounds as defined by the reference's current
+   *  dimensions, lin assertion errors will be triggered.
+   */
+  constexpr typename Traits::elem_t &operator()(size_t i, size_t j) {
+    return _mapping(i, j)[_lane];
+  }
+
+  /** @brief Provides read and write access to tensor elements.
+   *
+   *  @param i Index.
+   *
+   *  @return Reference to the referenced lane of the batch element.
+   *
+   *  Element access proceeds as if all the elements of the tensor stream were
+   *  flattened into an array in row major order.
+   *
+   *  If the index is out of bounds as defined by the reference's current size,
+   *  lin assertion errors will be triggered.
+   */
+  constexpr typename Traits::elem_t &operator()(size_t i) {
+    return _mapping(i)[_lane];
+  }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    Region r = _mapping.region();
+    r.origin += _lane * sizeof(typename Traits::elem_t);
+    r.elem = sizeof(typename Traits::elem_t);
+    return r;
+  }
+};
+
+template <class E>
+struct _elem<LaneMappingReference<E>> {
+  typedef typename _elem_t<E>::elem_t type;
+};
+
+template <class E>
+struct _dims<LaneMappingReference<E>> : _dims<E> { };
+
+template <class E>
+struct _layout<LaneMappingReference<E>> : _layout<E> { };
+
+template <class E>
+struct _linear<LaneMappingReference<E>> : is_linearly_addressable<E> { };
+}  // namespace internal
+}  // namespace lin
+
+#endif
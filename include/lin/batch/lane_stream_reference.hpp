@@ -0,0 +1,177 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/batch/lane_stream_reference.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_BATCH_LANE_STREAM_REFERENCE_HPP_
+#define LIN_BATCH_LANE_STREAM_REFERENCE_HPP_
+
+#include "../core.hpp"
+#include "lanes.hpp"
+
+#include <type_traits>
+
+namespace lin {
+namespace internal {
+
+/** @brief Reference to a single problem of a batch with read only access.
+ *
+ *  @tparam E Underlying batch type.
+ *
+ *  Exposes one lane of every element of a batch stream as an ordinary tensor
+ *  with the batch's dimensions. Evaluating the reference gathers the problem
+ *  out of the batch.
+ *
+ *  It's important to note, if the underlying stream goes out of scope the
+ *  reference is invalidated.
+ *
+ *  @sa internal::LaneMappingReference
+ *  @sa Batch
+ *
+ *  @ingroup BATCH
+ */
+template <class E>
+class LaneStreamReference : public Stream<LaneStreamReference<E>> {
+  static_assert(is_batch<E>::value,
+      "Underlying stream for a lane reference must be a batch.");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef traits<LaneStreamReference<E>> Traits;
+
+ private:
+  Stream<E> const &_stream;
+  size_t const _lane;
+
+ protected:
+  using Stream<LaneStreamReference<E>>::derived;
+
+ public:
+  using Stream<LaneStreamReference<E>>::size;
+  using Stream<LaneStreamReference<E>>::eval;
+
+  constexpr LaneStreamReference() = delete;
+  constexpr LaneStreamReference(LaneStreamReference<E> const &) = default;
+  constexpr LaneStreamReference(LaneStreamReference<E> &&) = default;
+  constexpr LaneStreamReference<E> &operator=(LaneStreamReference<E> const &) = default;
+  constexpr LaneStreamReference<E> &operator=(LaneStreamReference<E> &&) = default;
+
+  /** @brief Constructs a new lane reference with the provided stream.
+   *
+   *  @param stream Underlying batch.
+   *  @param k      Lane index.
+   *
+   *  The lane index must be less than the batch's width or lin assertion
+   *  errors will be triggered.
+   */
+  constexpr LaneStreamReference(Stream<E> const &stream, size_t k)
+  : _stream(stream), _lane(k) {
+    LIN_ASSERT(k < _elem_t<E>::width);
+  }
+
+  /** @return Number of rows.
+   */
+  constexpr size_t rows() const {
+    return _stream.rows();
+  }
+
+  /** @return Number of columns.
+   */
+  constexpr size_t cols() const {
+    return _stream.cols();
+  }
+
+  /** @brief Provides read only access to tensor elements.
+   *
+   *  @param i Row index.
+   *  @param j Column index.
+   *
+   *  @return Referenced lane of the batch element.
+   *
+   *  If the indices are out of bounds as defined by the reference's current
+   *  dimensions, lin assertion errors will be triggered.
+   */
+  constexpr typename Traits::elem_t operator()(size_t i, size_t j) const {
+    return _stream(i, j)[_lane];
+  }
+
+  /** @brief Provides read only access to tensor elements.
+   *
+   *  @param i Index.
+   *
+   *  @return Referenced lane of the batch element.
+   *
+   *  Element access proceeds as if all the elements of the tensor stream were
+   *  flattened into an array in row major order.
+   *
+   *  If the index is out of bounds as defined by the reference's current size,
+   *  lin assertion errors will be triggered.
+   */
+  constexpr typename Traits::elem_t operator()(size_t i) const {
+    return _stream(i)[_lane];
+  }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  Only available if the underlying stream is value backed or a reference to
+   *  one.
+   *
+   *  @sa internal::Region
+   */
+  template <class F = E, std::enable_if_t<has_region<F>::value, size_t> = 0>
+  inline Region region() const {
+    Region r = static_cast<F const &>(_stream).region();
+    r.origin += _lane * sizeof(typename Traits::elem_t);
+    r.elem = sizeof(typename Traits::elem_t);
+    return r;
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if evaluating the reference may read an overwritten element.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return aliases(r, positional, has_region<E>());
+  }
+
+ private:
+  inline bool aliases(Region const &r, bool positional, std::true_type) const {
+    return region_aliases(region(), r, positional);
+  }
+
+  inline bool aliases(Region const &r, bool positional, std::false_type) const {
+    return _stream.aliases(r, positional);
+  }
+};
+
+template <class E>
+struct _elem<LaneStreamReference<E>> {
+  typedef typename _elem_t<E>::elem_t type;
+};
+
+template <class E>
+struct _dims<LaneStreamReference<E>> : _dims<E> { };
+
+template <class E>
+struct _layout<LaneStreamReference<E>> : _layout<E> { };
+
+template <class E>
+struct _linear<LaneStreamReference<E>> : is_linearly_addressable<E> { };
+
+template <class E>
+struct _lazy_product<LaneStreamReference<E>> : has_lazy_product<E> { };
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -0,0 +1,189 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/batch/lanes.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_BATCH_LANES_HPP_
+#define LIN_BATCH_LANES_HPP_
+
+#include "../core.hpp"
+
+#include <cmath>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+
+/** @brief Element of a batch holding one scalar per problem.
+ *
+ *  @tparam T Scalar type.
+ *  @tparam N Number of lanes, i.e. problems in the batch.
+ *
+ *  Lanes behave like a scalar under arithmetic with every operation applied
+ *  lane by lane. All operations are straight line loops over a compile time
+ *  number of lanes which compilers readily lower to vector instructions.
+ *
+ *  Scalars implicitly convert to lanes by broadcasting. Like scalars, default
+ *  constructed lanes are uninitialized unless value initialized.
+ *
+ *  @sa Batch
+ *
+ *  @ingroup BATCH
+ */
+template <typename T, size_t N>
+struct Lanes {
+  static_assert(N > 0, "Lanes<...> must contain at least one lane");
+
+  /** @brief Scalar type of each lane.
+   */
+  typedef T elem_t;
+
+  /** @brief Number of lanes.
+   */
+  static constexpr size_t width = N;
+
+  /** @brief Lane values.
+   */
+  alignas(((sizeof(T) * N) % LIN_PACKET_BYTES) ? alignof(T) : LIN_PACKET_BYTES)
+  T values[N];
+
+  Lanes() = default;
+
+  /** @brief Broadcasts a scalar to every lane.
+   *
+   *  @param t Scalar.
+   */
+  constexpr Lanes(T const &t) : values{} {
+    for (size_t k = 0; k < N; k++) values[k] = t;
+  }
+
+  /** @param k Lane index.
+   *
+   *  @return Reference to the lane's value.
+   */
+  inline constexpr T &operator[](size_t k) {
+    return values[k];
+  }
+
+  /** @param k Lane index.
+   *
+   *  @return Constant reference to the lane's value.
+   */
+  inline constexpr T const &operator[](size_t k) const {
+    return values[k];
+  }
+
+  inline constexpr Lanes<T, N> &operator+=(Lanes<T, N> const &l) {
+    return *this = *this + l;
+  }
+
+  inline constexpr Lanes<T, N> &operator-=(Lanes<T, N> const &l) {
+    return *this = *this - l;
+  }
+
+  inline constexpr Lanes<T, N> &operator*=(Lanes<T, N> const &l) {
+    return *this = *this * l;
+  }
+
+  inline constexpr Lanes<T, N> &operator/=(Lanes<T, N> const &l) {
+    return *this = *this / l;
+  }
+
+  /* Operators are found through argument dependent lookup only so scalar
+   * operands convert by broadcasting.
+   */
+
+  friend inline constexpr Lanes<T, N> operator+(Lanes<T, N> const &l, Lanes<T, N> const &r) {
+    return apply(internal::add(), l, r, std::make_index_sequence<N>());
+  }
+
+  friend inline constexpr Lanes<T, N> operator-(Lanes<T, N> const &l, Lanes<T, N> const &r) {
+    return apply(internal::subtract(), l, r, std::make_index_sequence<N>());
+  }
+
+  friend inline constexpr Lanes<T, N> operator*(Lanes<T, N> const &l, Lanes<T, N> const &r) {
+    return apply(internal::multiply(), l, r, std::make_index_sequence<N>());
+  }
+
+  friend inline constexpr Lanes<T, N> operator/(Lanes<T, N> const &l, Lanes<T, N> const &r) {
+    return apply(internal::divide(), l, r, std::make_index_sequence<N>());
+  }
+
+  friend inline constexpr Lanes<T, N> operator+(Lanes<T, N> const &l) {
+    return l;
+  }
+
+  friend inline constexpr Lanes<T, N> operator-(Lanes<T, N> const &l) {
+    return apply(internal::negate(), l, std::make_index_sequence<N>());
+  }
+
+  /** @brief Lane wise square root.
+   *
+   *  Found by argument dependent lookup which is how lin::norm and lin::chol
+   *  apply to batches.
+   */
+  friend inline Lanes<T, N> sqrt(Lanes<T, N> const &l) {
+    return apply(lane_sqrt(), l, std::make_index_sequence<N>());
+  }
+
+  /** @brief Lane wise absolute value.
+   */
+  friend inline Lanes<T, N> abs(Lanes<T, N> const &l) {
+    return apply(lane_abs(), l, std::make_index_sequence<N>());
+  }
+
+ private:
+  struct lane_sqrt {
+    inline T operator()(T const &t) const { return std::sqrt(t); }
+  };
+
+  struct lane_abs {
+    inline T operator()(T const &t) const { return std::abs(t); }
+  };
+
+  /* Lane wise operations are written as straight line code rather than loops
+   * so each lane stays in a register without relying on loop unrolling.
+   */
+  template <class F, size_t... I>
+  static inline constexpr Lanes<T, N> apply(F const &f, Lanes<T, N> const &l,
+      std::index_sequence<I...>) {
+    Lanes<T, N> x = { };
+    (void) std::initializer_list<int>{ (x.values[I] = f(l.values[I]), 0)... };
+    return x;
+  }
+
+  template <class F, size_t... I>
+  static inline constexpr Lanes<T, N> apply(F const &f, Lanes<T, N> const &l,
+      Lanes<T, N> const &r, std::index_sequence<I...>) {
+    Lanes<T, N> x = { };
+    (void) std::initializer_list<int>{ (x.values[I] = f(l.values[I], r.values[I]), 0)... };
+    return x;
+  }
+};
+
+namespace internal {
+
+template <typename T>
+struct _is_lanes : std::false_type { };
+
+template <typename T, size_t N>
+struct _is_lanes<Lanes<T, N>> : std::true_type { };
+
+/** @brief Tests if a tensor type is a batch, i.e. its elements are lanes.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  @sa Batch
+ *  @sa Lanes
+ *
+ *  @ingroup BATCH
+ */
+template <class C>
+struct is_batch : _is_lanes<_elem_t<C>> { };
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
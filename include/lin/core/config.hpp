@@ -24,6 +24,119 @@
   #define LIN_ASSERT(x)
 #endif
 
+/** @def LIN_PACKET_BYTES
+ *  @brief Width, in bytes, of the packets used when evaluating tensor streams.
+ *
+ *  Element wise expressions whose leaves all support packet access are
+ *  evaluated a packet at a time. This width is picked to match the widest
+ *  vector registers the target is known to have and can be overridden by
+ *  defining the `LIN_PACKET_BYTES` macro when building.
+ *
+ *  @ingroup CORE
+ */
+
+#ifndef LIN_PACKET_BYTES
+  #if defined(__AVX512F__)
+    #define LIN_PACKET_BYTES 64
+  #elif defined(__AVX__)
+    #define LIN_PACKET_BYTES 32
+  #else
+    #define LIN_PACKET_BYTES 16
+  #endif
+#endif
+
+/** @def LIN_UNROLL_MAX_DIMENSION
+ *  @brief Largest row or column count of a fixed size tensor whose operations
+ *         are fully unrolled.
+ *
+ *  Can be overridden by defining the `LIN_UNROLL_MAX_DIMENSION` macro when
+ *  building. Defining it as zero disables unrolling altogether.
+ *
+ *  @sa internal::is_unrollable
+ *
+ *  @ingroup CORE
+ */
+
+#ifndef LIN_UNROLL_MAX_DIMENSION
+  #define LIN_UNROLL_MAX_DIMENSION 6
+#endif
+
+/** @def LIN_TRANSPOSE_TILE
+ *  @brief Row and column count of the square tiles elements are copied in
+ *         when the source and destination of an assignment have different
+ *         layouts.
+ *
+ *  Copying a row major tensor into a column major one, say in
+ *  `A = transpose(B)`, reads one of the two with a large stride. Working a tile
+ *  at a time keeps both the tile being read and the tile being written in
+ *  cache. Can be overridden by defining the `LIN_TRANSPOSE_TILE` macro when
+ *  building.
+ *
+ *  @sa transpose_inplace
+ *
+ *  @ingroup CORE
+ */
+
+#ifndef LIN_TRANSPOSE_TILE
+  #define LIN_TRANSPOSE_TILE 16
+#endif
+
+/** @def LIN_MATERIALIZE_HOOK(T, r, c)
+ *  @brief Invoked whenever a lazily evaluated product nested within another
+ *         product is evaluated into a temporary.
+ *
+ *  The arguments are the type of the evaluated stream along with its row and
+ *  column counts. By default this does nothing. Defining the
+ *  `LIN_PROFILE_MATERIALIZE` macro when building reports each occurrence on
+ *  standard error and a custom hook can be provided by defining the
+ *  `LIN_MATERIALIZE_HOOK` macro directly.
+ *
+ *  @sa internal::has_lazy_product
+ *
+ *  @ingroup CORE
+ */
+
+#ifndef LIN_MATERIALIZE_HOOK
+  #ifdef LIN_PROFILE_MATERIALIZE
+    #include <cstdio>
+    #include <typeinfo>
+    #define LIN_MATERIALIZE_HOOK(T, r, c) \
+        std::fprintf(stderr, "lin: materialized %zu x %zu %s\n", \
+            std::size_t(r), std::size_t(c), typeid(T).name())
+  #else
+    #define LIN_MATERIALIZE_HOOK(T, r, c) ((void) (r), (void) (c))
+  #endif
+#endif
+
+/** @def LIN_CONSTANT_EVALUATED()
+ *  @brief Whether the enclosing code is being evaluated as part of a constant
+ *         expression.
+ *
+ *  Tensor regions are built from addresses which can't be inspected within a
+ *  constant expression so, when this is true, assignments skip the alias test
+ *  and conservatively evaluate into a temporary. Relies on a compiler builtin
+ *  and is always false otherwise, in which case assignments with an alias
+ *  test can't be used in constant expressions.
+ *
+ *  @sa internal::Mapping::operator=(Stream<C> const &)
+ *
+ *  @ingroup CORE
+ */
+
+#ifndef LIN_CONSTANT_EVALUATED
+  #if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+      #define LIN_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+    #endif
+  #endif
+  #if !defined(LIN_CONSTANT_EVALUATED) && !defined(__clang__) && defined(__GNUC__) && (__GNUC__ >= 9)
+    #define LIN_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+  #endif
+  #ifndef LIN_CONSTANT_EVALUATED
+    #define LIN_CONSTANT_EVALUATED() false
+  #endif
+#endif
+
 namespace lin {
 
 /** @brief Type tracking tensor dimensions and sizing.
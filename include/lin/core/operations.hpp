@@ -16,7 +16,9 @@
 #define LIN_CORE_OPERATIONS_HPP_
 
 #include "operations/functors.hpp"
+#include "operations/gemm.hpp"
 #include "operations/matrix_operations.hpp"
+#include "operations/reductions.hpp"
 #include "operations/stream_element_wise_operator.hpp"
 #include "operations/stream_multiply.hpp"
 #include "operations/stream_transpose.hpp"
@@ -0,0 +1,327 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/operations/gemm.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_OPERATIONS_GEMM_HPP_
+#define LIN_CORE_OPERATIONS_GEMM_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+#include "../types/mapping.hpp"
+#include "../types/packet.hpp"
+#include "../types/stream.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace lin {
+namespace internal {
+
+/** @brief Computes `a * b + c`.
+ *
+ *  Accumulation loops throughout lin call this rather than spelling out the
+ *  expression. Where the target has a fast, fused instruction for the element
+ *  type, as reported by `FP_FAST_FMA` and `FP_FAST_FMAF`, the result is
+ *  computed with `std::fma` and a single rounding. Otherwise `std::fma` would
+ *  fall back to a slow software routine and the expression is evaluated as
+ *  written.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename T, typename U, typename V>
+inline constexpr auto fmadd(T const &a, U const &b, V const &c) {
+  return a * b + c;
+}
+
+#ifdef FP_FAST_FMA
+inline double fmadd(double a, double b, double c) {
+  return std::fma(a, b, c);
+}
+#endif
+
+#ifdef FP_FAST_FMAF
+inline float fmadd(float a, float b, float c) {
+  return std::fma(a, b, c);
+}
+#endif
+
+/** @brief Operand of a matrix product held in row major memory.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Row major, value backed operands are referenced in place. Any other stream,
+ *  including column major types, is evaluated once into a row major temporary
+ *  of its evaluation type so the multiplication kernel never has to lazily
+ *  recompute an element.
+ *
+ *  @sa internal::gemm
+ *  @sa internal::is_value_backed
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <class C, typename = void>
+class PackedStream {
+ private:
+  /** @brief Evaluated operand.
+   */
+  traits_eval_t<C> const c;
+
+ public:
+  /** @brief Evaluates a stream into contiguous memory.
+   *
+   *  @param s %Tensor stream.
+   */
+  constexpr PackedStream(Stream<C> const &s)
+  : c(s) { }
+
+  /** @return Pointer to the first element of the operand.
+   */
+  constexpr traits_elem_t<C> const *data() const {
+    return c.data();
+  }
+
+  /** @return Leading dimension of the operand.
+   */
+  constexpr size_t stride() const {
+    return c.stride();
+  }
+};
+
+template <class C>
+class PackedStream<C, std::enable_if_t<conjunction<
+    is_value_backed<C>, negation<is_col_major<C>>>::value>> {
+ private:
+  /** @brief Value backed operand.
+   */
+  C const &c;
+
+ public:
+  /** @brief References a value backed stream in place.
+   *
+   *  @param s %Tensor stream.
+   */
+  constexpr PackedStream(Stream<C> const &s)
+  : c(static_cast<C const &>(s)) { }
+
+  /** @return Pointer to the first element of the operand.
+   */
+  constexpr traits_elem_t<C> const *data() const {
+    return c.data();
+  }
+
+  /** @return Leading dimension of the operand.
+   */
+  constexpr size_t stride() const {
+    return c.stride();
+  }
+};
+
+/** @brief Rows in a block of the matrix multiplication kernel.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+constexpr size_t gemm_block_rows = 4;
+
+/** @brief Columns in a block of the matrix multiplication kernel.
+ *
+ *  @tparam T Element type of the product.
+ *
+ *  Two packets wide so each block row is accumulated in a pair of vector
+ *  registers.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename T>
+struct gemm_block_cols : std::integral_constant<size_t, 2 * packet_size<T>::value> { };
+
+/** @brief Accumulates a block of a matrix product.
+ *
+ *  @tparam MR Rows in the block.
+ *  @tparam NR Columns in the block.
+ *
+ *  @param k   Inner dimension of the product.
+ *  @param a   Pointer to the first element of the block's rows in the left
+ *             operand.
+ *  @param lda Leading dimension of the left operand.
+ *  @param b   Pointer to the first element of the block's columns in the right
+ *             operand.
+ *  @param ldb Leading dimension of the right operand.
+ *  @param acc Block accumulator.
+ *
+ *  Every element of the block is accumulated in order of increasing `k` just as
+ *  internal::StreamMultiply::operator()(size_t, size_t) const would.
+ */
+template <size_t MR, size_t NR, typename T, typename U, typename V>
+inline constexpr void gemm_block(size_t k, T const *a, size_t lda, U const *b,
+    size_t ldb, V (&acc)[MR][NR]) {
+  for (size_t p = 0; p < k; p++) {
+    for (size_t r = 0; r < MR; r++) {
+      V const x = a[r * lda + p];
+      for (size_t c = 0; c < NR; c++) acc[r][c] = fmadd(x, b[p * ldb + c], acc[r][c]);
+    }
+  }
+}
+
+/** @brief Stores an element of a matrix product as is.
+ *
+ *  @sa internal::gemm
+ *
+ *  @ingroup COREOPERATIONS
+ */
+struct gemm_store {
+  template <typename R>
+  inline constexpr R operator()(size_t, size_t, R const &acc) const {
+    return acc;
+  }
+};
+
+/** @brief Stores an element of a scaled matrix product, `alpha * A * B`.
+ *
+ *  @tparam R Element type of the product.
+ *
+ *  @sa internal::gemm
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R>
+struct gemm_scale {
+  R const alpha;
+
+  inline constexpr R operator()(size_t, size_t, R const &acc) const {
+    return alpha * acc;
+  }
+};
+
+/** @brief Stores an element of an affine expression,
+ *         `alpha * A * B + beta * Y`.
+ *
+ *  @tparam R Element type of the product.
+ *  @tparam Y %Tensor type of the addend.
+ *
+ *  Element `(i, j)` of the addend is read right before element `(i, j)` of the
+ *  result is written so the addend may be the destination itself.
+ *
+ *  @sa internal::gemm
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R, class Y>
+struct gemm_affine {
+  R const alpha;
+  R const beta;
+  Stream<Y> const &y;
+
+  inline constexpr R operator()(size_t i, size_t j, R const &acc) const {
+    return fmadd(alpha, acc, beta * y(i, j));
+  }
+};
+
+/** @brief Evaluates a matrix product into a mapping.
+ *
+ *  @tparam R Element type of the product.
+ *
+ *  @param m   Rows in the result.
+ *  @param n   Columns in the result.
+ *  @param k   Inner dimension of the product.
+ *  @param a   Pointer to the left operand's elements in row major order.
+ *  @param lda Leading dimension of the left operand.
+ *  @param b   Pointer to the right operand's elements in row major order.
+ *  @param ldb Leading dimension of the right operand.
+ *  @param x   Result.
+ *  @param f   Epilogue mapping an element's indices and accumulated dot product
+ *             to the value stored in the result.
+ *
+ *  The result is computed in register sized blocks of `gemm_block_rows` by
+ *  `gemm_block_cols` elements. Each block reads a few rows of the left operand
+ *  and a contiguous run of the right operand's columns so the accumulators stay
+ *  in registers for the entire inner loop. Elements along the bottom and right
+ *  edges of the result, where a full block no longer fits, are computed as
+ *  individual dot products.
+ *
+ *  Each element is passed through the epilogue exactly once, as soon as its dot
+ *  product is complete, which lets scaling and accumulating into another tensor
+ *  happen in the same pass.
+ *
+ *  If the result is symmetric, blocks entirely above the diagonal are skipped
+ *  and only elements on or below it are stored.
+ *
+ *  @sa internal::PackedStream
+ *  @sa internal::is_symmetric
+ *  @sa internal::gemm_store
+ *  @sa internal::gemm_scale
+ *  @sa internal::gemm_affine
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R, typename T, typename U, class E, class F>
+inline constexpr void gemm(size_t m, size_t n, size_t k, T const *a, size_t lda,
+    U const *b, size_t ldb, Mapping<E> &x, F const &f) {
+  constexpr size_t MR = gemm_block_rows;
+  constexpr size_t NR = gemm_block_cols<R>::value;
+  constexpr bool lower = is_symmetric<E>::value;
+
+  for (size_t i = 0; i < m; i += MR) {
+    size_t const mr = (m - i < MR) ? m - i : MR;
+    size_t const ne = lower ? i + mr : n;
+    for (size_t j = 0; j < ne; j += NR) {
+      size_t const nr = (n - j < NR) ? n - j : NR;
+
+      if (mr == MR && nr == NR) {
+        R acc[MR][NR] = { };
+        gemm_block(k, a + i * lda, lda, b + j, ldb, acc);
+        for (size_t r = 0; r < MR; r++)
+          for (size_t c = 0; c < NR && (!lower || j + c <= i + r); c++)
+            x(i + r, j + c) = f(i + r, j + c, acc[r][c]);
+      } else {
+        for (size_t r = 0; r < mr; r++) {
+          for (size_t c = 0; c < nr && (!lower || j + c <= i + r); c++) {
+            R acc = R(0);
+            for (size_t p = 0; p < k; p++) acc = fmadd(a[(i + r) * lda + p], b[p * ldb + j + c], acc);
+            x(i + r, j + c) = f(i + r, j + c, acc);
+          }
+        }
+      }
+    }
+  }
+}
+
+/** @brief Evaluates a matrix product into a mapping.
+ *
+ *  Equivalent to passing internal::gemm_store as the epilogue.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R, typename T, typename U, class E>
+inline constexpr void gemm(size_t m, size_t n, size_t k, T const *a, size_t lda,
+    U const *b, size_t ldb, Mapping<E> &x) {
+  gemm<R>(m, n, k, a, lda, b, ldb, x, gemm_store());
+}
+
+/** @brief Matrix multiplication driver evaluating products on the calling
+ *         thread.
+ *
+ *  Drivers carry out the packed products of internal::StreamMultiply::eval_to.
+ *  Their `run` member takes the same arguments as internal::gemm and must
+ *  produce the same result. Their `packed_t` member template holds each
+ *  packed operand. This one simply calls internal::gemm.
+ *
+ *  @sa internal::StreamMultiply::eval_to
+ *
+ *  @ingroup COREOPERATIONS
+ */
+struct gemm_serial {
+  template <class C>
+  using packed_t = PackedStream<C>;
+
+  template <typename R, typename T, typename U, class E, class F>
+  inline constexpr void run(size_t m, size_t n, size_t k, T const *a, size_t lda,
+      U const *b, size_t ldb, Mapping<E> &x, F const &f) const {
+    gemm<R>(m, n, k, a, lda, b, ldb, x, f);
+  }
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
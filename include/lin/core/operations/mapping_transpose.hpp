@@ -89,6 +89,17 @@ class MappingTranspose : public Mapping<MappingTranspose<C>> {
   constexpr typename Traits::elem_t &operator()(size_t i) {
     return (*this)(i / cols(), i % cols());
   }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  This is the underlying mapping's region with the roles of rows and columns
+   *  swapped.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    return c.region().transpose();
+  }
 };
 
 template <class C>
@@ -101,6 +112,9 @@ struct _dims<MappingTranspose<C>> {
   static constexpr size_t max_rows = _dims<C>::max_cols;
   static constexpr size_t max_cols = _dims<C>::max_rows;
 };
+
+template <class C>
+struct _layout<MappingTranspose<C>> : _transposed_layout<typename _layout<C>::type> { };
 }  // namespace internal
 }  // namespace lin
 
@@ -9,11 +9,30 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "../types/mapping.hpp"
 #include "../types/stream.hpp"
+#include "reductions.hpp"
 
+#include <initializer_list>
 #include <type_traits>
+#include <utility>
 
 namespace lin {
+namespace internal {
+
+template <class C>
+constexpr auto _trace(Stream<C> const &c, std::false_type) {
+  return reduce_diagonal<traits_elem_t<C>>(reduce_sum(), c);
+}
+
+template <class C, size_t... I>
+constexpr auto _trace(Stream<C> const &c, std::index_sequence<I...>) {
+  typename C::Traits::elem_t x = c(0, 0);
+  (void) std::initializer_list<int>{ (x += c(I + 1, I + 1), 0)... };
+  return x;
+}
+
+}  // namespace internal
 
 /** @weakgroup COREOPERATIONS
  *  @{
@@ -23,9 +42,50 @@ template <class C, std::enable_if_t<internal::is_square<C>::value, size_t> = 0>
 constexpr auto trace(internal::Stream<C> const &c) {
   LIN_ASSERT(c.rows() == c.cols());
 
-  typename C::Traits::elem_t x = c(0, 0);
-  for (lin::size_t i = 1; i < c.rows(); i++) x += c(i, i);
-  return x;
+  return internal::_trace(c, internal::unroll_t<
+      internal::is_unrollable<C>::value, C::Traits::rows - 1>());
+}
+
+/** @brief Transposes a square matrix in place.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  @param c Square matrix.
+ *
+ *  Unlike `c = transpose(c)`, which has to evaluate the transpose into a
+ *  temporary, elements are swapped across the diagonal directly. The matrix
+ *  is worked through in pairs of `LIN_TRANSPOSE_TILE` by `LIN_TRANSPOSE_TILE`
+ *  tiles mirrored across the diagonal so both stay in cache.
+ *
+ *  If the matrix isn't square at runtime, a lin assertion error will be
+ *  triggered.
+ *
+ *  @sa LIN_TRANSPOSE_TILE
+ */
+template <class C, std::enable_if_t<internal::is_square<C>::value, size_t> = 0>
+constexpr void transpose_inplace(internal::Mapping<C> &c) {
+  LIN_ASSERT(c.rows() == c.cols());
+
+  constexpr size_t T = LIN_TRANSPOSE_TILE;
+  size_t const n = c.rows();
+  for (size_t i = 0; i < n; i += T) {
+    size_t const ie = (n - i < T) ? n : i + T;
+    for (size_t j = i; j < n; j += T) {
+      size_t const je = (n - j < T) ? n : j + T;
+      for (size_t k = i; k < ie; k++) {
+        for (size_t l = (i == j) ? k + 1 : j; l < je; l++) {
+          typename C::Traits::elem_t const x = c(k, l);
+          c(k, l) = c(l, k);
+          c(l, k) = x;
+        }
+      }
+    }
+  }
+}
+
+template <class C, std::enable_if_t<internal::is_square<C>::value, size_t> = 0>
+constexpr void transpose_inplace(internal::Mapping<C> &&c) {
+  transpose_inplace(c);
 }
 
 /** @}
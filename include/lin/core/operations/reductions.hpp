@@ -0,0 +1,338 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/operations/reductions.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_OPERATIONS_REDUCTIONS_HPP_
+#define LIN_CORE_OPERATIONS_REDUCTIONS_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+#include "../types/packet.hpp"
+#include "../types/stream.hpp"
+#include "gemm.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @brief Number of independent packet accumulators used by reductions.
+ *
+ *  Each accumulator is a full packet so a reduction keeps this many times
+ *  internal::packet_size partial sums in flight. This hides the latency of the
+ *  floating point adds which would otherwise serialize the loop.
+ *
+ *  @sa internal::reduce
+ *
+ *  @ingroup COREOPERATIONS
+ */
+constexpr size_t reduce_accumulators = 4;
+
+/** @brief Accumulation step of a sum.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+struct reduce_sum {
+  template <typename R, typename T>
+  inline constexpr R operator()(R const &r, T const &t) const {
+    return r + t;
+  }
+};
+
+/** @brief Accumulation step of a sum of squares.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+struct reduce_square {
+  template <typename R, typename T>
+  inline constexpr R operator()(R const &r, T const &t) const {
+    return fmadd(t, t, r);
+  }
+};
+
+/** @brief Accumulation step of a sum of products.
+ *
+ *  @ingroup COREOPERATIONS
+ */
+struct reduce_product {
+  template <typename R, typename T, typename U>
+  inline constexpr R operator()(R const &r, T const &t, U const &u) const {
+    return fmadd(t, u, r);
+  }
+};
+
+/* Element access paths of a reduction. Each visits elements as `outer` runs of
+ * `inner` elements where element `j` of run `i` is read by _reduce_load and
+ * _reduce_elem.
+ */
+template <class L>
+struct _reduce_packets { };
+
+struct _reduce_linear { };
+
+struct _reduce_nested { };
+
+struct _reduce_diagonal { };
+
+struct _reduce_symmetric { };
+
+template <class... Cs>
+using _reduce_path_t = std::conditional_t<
+    conjunction<std::integral_constant<bool, sizeof...(Cs) == 1>, is_symmetric<Cs>...>::value,
+    _reduce_symmetric,
+    std::conditional_t<
+        have_packet_access<Cs...>::value,
+        _reduce_packets<typename _packet_join<_packet<Cs>...>::layout>,
+        std::conditional_t<
+            conjunction<is_linearly_addressable<Cs>...>::value,
+            _reduce_linear,
+            _reduce_nested
+          >
+      >
+  >;
+
+template <size_t N, class C, class L>
+inline constexpr Packet<traits_elem_t<C>, N> _reduce_load(
+    Stream<C> const &c, size_t i, size_t j, size_t stride, _reduce_packets<L>) {
+  return c.template packet<N>(i * stride + j);
+}
+
+template <size_t N, class C>
+inline constexpr Packet<traits_elem_t<C>, N> _reduce_load(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_linear) {
+  Packet<traits_elem_t<C>, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = c(j + k);
+  return p;
+}
+
+template <size_t N, class C>
+inline constexpr Packet<traits_elem_t<C>, N> _reduce_load(
+    Stream<C> const &c, size_t i, size_t j, size_t, _reduce_nested) {
+  Packet<traits_elem_t<C>, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = c(i, j + k);
+  return p;
+}
+
+template <size_t N, class C>
+inline constexpr Packet<traits_elem_t<C>, N> _reduce_load(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_diagonal) {
+  Packet<traits_elem_t<C>, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = c(j + k, j + k);
+  return p;
+}
+
+template <size_t N, class C>
+inline constexpr Packet<traits_elem_t<C>, N> _reduce_load(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_symmetric) {
+  return packet_load<N>(static_cast<C const &>(c).packed() + j);
+}
+
+template <class C, class L>
+inline constexpr traits_elem_t<C> _reduce_elem(
+    Stream<C> const &c, size_t i, size_t j, size_t stride, _reduce_packets<L>) {
+  return c.template packet<1>(i * stride + j)[0];
+}
+
+template <class C>
+inline constexpr traits_elem_t<C> _reduce_elem(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_linear) {
+  return c(j);
+}
+
+template <class C>
+inline constexpr traits_elem_t<C> _reduce_elem(
+    Stream<C> const &c, size_t i, size_t j, size_t, _reduce_nested) {
+  return c(i, j);
+}
+
+template <class C>
+inline constexpr traits_elem_t<C> _reduce_elem(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_diagonal) {
+  return c(j, j);
+}
+
+template <class C>
+inline constexpr traits_elem_t<C> _reduce_elem(
+    Stream<C> const &c, size_t, size_t j, size_t, _reduce_symmetric) {
+  return static_cast<C const &>(c).packed()[j];
+}
+
+/* Packet strides are only meaningful for the packet path. Streams reporting
+ * packet_any_stride are indexed as if they were dense.
+ */
+template <class... Cs>
+struct _reduce_stride : std::integral_constant<size_t, (
+    (_packet_join<_packet<Cs>...>::stride == packet_any_stride)
+        ? 0 : _packet_join<_packet<Cs>...>::stride
+  )> { };
+
+template <typename T>
+inline constexpr T _reduce_combine(T const &t, T const &u) {
+  return t + u;
+}
+
+template <typename T, size_t N>
+inline constexpr Packet<T, N> _reduce_combine(Packet<T, N> const &t, Packet<T, N> const &u) {
+  return packet_apply<T>(reduce_sum(), t, u);
+}
+
+/* Combines the first n entries of t pairwise, halving the count each round,
+ * and returns the result in t[0].
+ */
+template <typename T>
+inline constexpr T _reduce_tree(T *t, size_t n) {
+  for (; n > 1; n = (n + 1) / 2)
+    for (size_t k = 0; k < n / 2; k++) t[k] = _reduce_combine(t[k], t[k + (n + 1) / 2]);
+  return t[0];
+}
+
+/* Longest run any of the tensors can hold. Tensors too small for a full set of
+ * accumulators are always reduced serially.
+ */
+template <class... Cs>
+inline constexpr size_t _reduce_bound() {
+  size_t const s[] = {traits<Cs>::max_size...};
+  size_t m = s[0];
+  for (size_t x : s) m = (x < m) ? x : m;
+  return m;
+}
+
+template <typename R, class G, class P, class... Cs>
+inline constexpr R _reduce_kernel(G const &g, P, size_t outer, size_t inner, size_t stride,
+    Stream<Cs> const &... cs) {
+  constexpr size_t N = packet_size<R>::value;
+  constexpr size_t A = reduce_accumulators;
+  constexpr size_t M = _reduce_bound<Cs...>();
+
+  R r = R(0);
+  if (M < A * N || inner < A * N) {
+    for (size_t i = 0; i < outer; i++)
+      for (size_t j = 0; j < inner; j++) r = g(r, _reduce_elem(cs, i, j, stride, P())...);
+    return r;
+  }
+
+  // Remaining lengths are compared rather than end indices so the loop bounds
+  // can't overflow
+  Packet<R, N> acc[A] = { };
+  for (size_t i = 0; i < outer; i++) {
+    size_t j = 0;
+    for (; inner - j >= A * N; j += A * N)
+      for (size_t a = 0; a < A; a++)
+        acc[a] = packet_apply<R>(g, acc[a], _reduce_load<N>(cs, i, j + a * N, stride, P())...);
+    for (; inner - j >= N; j += N)
+      acc[0] = packet_apply<R>(g, acc[0], _reduce_load<N>(cs, i, j, stride, P())...);
+    for (; j < inner; j++) r = g(r, _reduce_elem(cs, i, j, stride, P())...);
+  }
+
+  Packet<R, N> p = _reduce_tree(acc, A);
+  return _reduce_tree(p.lanes, N) + r;
+}
+
+template <typename R, class G, class L, class C, class... Cs>
+inline constexpr R _reduce(G const &g, _reduce_packets<L>, Stream<C> const &c,
+    Stream<Cs> const &... cs) {
+  constexpr size_t stride = _reduce_stride<C, Cs...>::value;
+  constexpr bool col_major = std::is_same<L, ColMajor>::value;
+
+  if (!stride) return _reduce_kernel<R>(g, _reduce_packets<L>(), 1, c.size(), 0, c, cs...);
+  return _reduce_kernel<R>(g, _reduce_packets<L>(), col_major ? c.cols() : c.rows(),
+      col_major ? c.rows() : c.cols(), stride, c, cs...);
+}
+
+template <typename R, class G, class C, class... Cs>
+inline constexpr R _reduce(G const &g, _reduce_linear, Stream<C> const &c,
+    Stream<Cs> const &... cs) {
+  return _reduce_kernel<R>(g, _reduce_linear(), 1, c.size(), 0, c, cs...);
+}
+
+template <typename R, class G, class C, class... Cs>
+inline constexpr R _reduce(G const &g, _reduce_nested, Stream<C> const &c,
+    Stream<Cs> const &... cs) {
+  return _reduce_kernel<R>(g, _reduce_nested(), c.rows(), c.cols(), 0, c, cs...);
+}
+
+/* Elements off the diagonal of a symmetric tensor are stored once but appear
+ * twice. The packed triangle is reduced as a single dense run, doubled, and
+ * the diagonal taken back out.
+ */
+template <typename R, class G, class C>
+inline constexpr R _reduce(G const &g, _reduce_symmetric, Stream<C> const &c) {
+  size_t const n = c.rows();
+  R const t = _reduce_kernel<R>(g, _reduce_symmetric(), 1, n * (n + 1) / 2, 0, c);
+  R const d = _reduce_kernel<R>(g, _reduce_diagonal(), 1, n, 0, c);
+  return (t + t) - d;
+}
+
+/** @brief Reduces the elements of one or more tensors to a single sum.
+ *
+ *  @tparam R  Result type.
+ *  @tparam G  Accumulation step type.
+ *  @tparam Cs %Tensor types.
+ *
+ *  @param g  Accumulation step called as `g(r, c(i, j)...)` and returning the
+ *            updated partial sum `r`.
+ *  @param cs Tensors with equal dimensions.
+ *
+ *  @return Sum of the accumulation step over every element.
+ *
+ *  Rather than a single serial chain, elements are accumulated into
+ *  internal::reduce_accumulators packet sized partial sums. When the tensors
+ *  support packet access together, elements are loaded a packet at a time in
+ *  the order they're stored. Otherwise packets are gathered element by element.
+ *
+ *  The summation order is fixed for a given tensor shape and packet size.
+ *  Elements are visited as runs; the whole tensor if it's dense or linearly
+ *  addressable and each row, or column if column major, otherwise. Runs
+ *  shorter than internal::reduce_accumulators packets are summed serially.
+ *  Otherwise, consecutive packets of a run go to consecutive accumulators, left
+ *  over packets go to the first accumulator, and remaining elements go to a
+ *  scalar partial sum. The accumulators and then their lanes are combined
+ *  pairwise as a balanced tree before the scalar partial sum is added.
+ *
+ *  A single symmetric tensor is reduced over its packed lower triangle, a
+ *  packet at a time, with elements off the diagonal counted twice. The
+ *  accumulation step must then add one term per element, as all of the ones
+ *  below do.
+ *
+ *  @sa internal::reduce_sum
+ *  @sa internal::reduce_square
+ *  @sa internal::reduce_product
+ *  @sa internal::is_symmetric
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R, class G, class... Cs>
+inline constexpr R reduce(G const &g, Stream<Cs> const &... cs) {
+  return _reduce<R>(g, _reduce_path_t<Cs...>(), cs...);
+}
+
+/** @brief Reduces the main diagonal of a square tensor to a single sum.
+ *
+ *  @tparam R Result type.
+ *  @tparam G Accumulation step type.
+ *  @tparam C %Tensor type.
+ *
+ *  @param g Accumulation step called as `g(r, c(i, i))`.
+ *  @param c Square tensor.
+ *
+ *  @return Sum of the accumulation step over the diagonal.
+ *
+ *  Diagonal elements are gathered into packets and summed in the same order
+ *  described by internal::reduce.
+ *
+ *  @sa internal::reduce
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <typename R, class G, class C>
+inline constexpr R reduce_diagonal(G const &g, Stream<C> const &c) {
+  return _reduce_kernel<R>(g, _reduce_diagonal(), 1, c.rows(), 0, c);
+}
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -8,7 +8,9 @@
 #define LIN_CORE_STREAM_ELEMENT_WISE_OPERATOR_HPP_
 
 #include "../config.hpp"
+#include "../types/packet.hpp"
 #include "../types/stream.hpp"
+#include "stream_multiply.hpp"
 
 #include <tuple>
 #include <type_traits>
@@ -17,6 +19,9 @@
 namespace lin {
 namespace internal {
 
+template <class C, typename = void>
+struct _affine;
+
 /** @brief Proxy to a lazily evalutated element wise operation.
  * 
  *  @tparam F  Functor type.
@@ -66,6 +71,18 @@ class StreamElementWiseOperator : public Stream<StreamElementWiseOperator<F, Cs.
     return f(std::get<S>(cs)(i)...);
   }
 
+  template <size_t N, typename T, T... S>
+  inline constexpr Packet<typename Traits::elem_t, N> apply_packet(size_t i, std::integer_sequence<T, S...>) const {
+    return packet_apply<typename Traits::elem_t>(f, std::get<S>(cs).template packet<N>(i)...);
+  }
+
+  template <typename T, T... S>
+  inline bool apply_aliases(Region const &r, bool positional, std::integer_sequence<T, S...>) const {
+    bool const a[] = {std::get<S>(cs).aliases(r, positional)...};
+    for (bool b : a) if (b) return true;
+    return false;
+  }
+
  protected:
   using Stream<StreamElementWiseOperator<F, Cs...>>::derived;
 
@@ -89,6 +106,21 @@ class StreamElementWiseOperator : public Stream<StreamElementWiseOperator<F, Cs.
   constexpr StreamElementWiseOperator(Stream<Cs> const &... cs, Ts &&... fargs)
   : f(fargs...), cs(cs...) { }
 
+  /** @return Element wise functor.
+   */
+  inline constexpr F const &functor() const {
+    return f;
+  }
+
+  /** @tparam I Argument index.
+   *
+   *  @return Reference to an argument of the operation.
+   */
+  template <size_t I>
+  inline constexpr auto const &argument() const {
+    return std::get<I>(cs);
+  }
+
   /** @return Number of rows in the tensor.
    */
   inline constexpr size_t rows() const {
@@ -134,6 +166,69 @@ class StreamElementWiseOperator : public Stream<StreamElementWiseOperator<F, Cs.
   constexpr typename Traits::elem_t operator()(size_t i) const {
     return apply(i, std::index_sequence_for<Cs...>());
   }
+
+  /** @brief Lazily evaluates a packet of tensor elements.
+   *
+   *  @tparam N Number of lanes.
+   *
+   *  @param i Offset of the first element.
+   *
+   *  @return Packet holding the resulting values of the elements at offsets `i`
+   *          through `i + N - 1`.
+   *
+   *  The functor is applied lane by lane to packets read from each argument.
+   *  This is only available if all arguments support packet access with the
+   *  same stride and layout.
+   *
+   *  @sa internal::has_packet_access
+   *  @sa internal::packet_stride
+   */
+  template <size_t N>
+  constexpr Packet<typename Traits::elem_t, N> packet(size_t i) const {
+    return apply_packet<N>(i, std::index_sequence_for<Cs...>());
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if any of the arguments alias the region.
+   *
+   *  Element `(i, j)` only depends on element `(i, j)` of each argument so
+   *  `positional` is passed through untouched.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return apply_aliases(r, positional, std::index_sequence_for<Cs...>());
+  }
+
+  /** @brief Evaluates an affine expression into a mapping.
+   *
+   *  @tparam E Destination type.
+   *
+   *  @param m Destination mapping.
+   *
+   *  Only available for sums and differences of a matrix product, possibly
+   *  scaled, and another stream such as `alpha * A * B + beta * C`. The entire
+   *  expression is then evaluated in a single pass by the product.
+   *
+   *  This is called by internal::Mapping::operator=(Stream<C> const &) and
+   *  shouldn't need to be called directly.
+   *
+   *  @sa internal::_affine
+   *  @sa internal::StreamMultiply::eval_to
+   */
+  template <class E, class G = StreamElementWiseOperator<F, Cs...>, std::enable_if_t<
+      _affine<G>::value, size_t> = 0>
+  constexpr void eval_to(Mapping<E> &m) const {
+    typedef _affine<G> A;
+    A::product(*this).eval_to(m, A::template alpha<typename Traits::elem_t>(*this),
+        A::template beta<typename Traits::elem_t>(*this), A::addend(*this));
+  }
 };
 
 template <class F, class... Cs>
@@ -144,6 +239,136 @@ struct _elem<StreamElementWiseOperator<F, Cs...>> {
 template <class F, class C, class... Cs>
 struct _dims<StreamElementWiseOperator<F, C, Cs...>> : _dims<C> { };
 
+template <class F, class C, class... Cs>
+struct _layout<StreamElementWiseOperator<F, C, Cs...>> : _layout<C> { };
+
+template <class F, class... Cs>
+struct _linear<StreamElementWiseOperator<F, Cs...>>
+    : conjunction<is_linearly_addressable<Cs>...> { };
+
+template <class F, class... Cs>
+struct _packet<StreamElementWiseOperator<F, Cs...>>
+    : _packet_join<_packet<Cs>...> { };
+
+template <class F, class... Cs>
+struct _lazy_product<StreamElementWiseOperator<F, Cs...>>
+    : disjunction<has_lazy_product<Cs>...> { };
+
+/** @brief Tests if a tensor stream is a matrix product, possibly scaled by a
+ *         scalar, and provides access to its parts.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  @sa internal::_affine
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <class C, typename = void>
+struct _product_term : std::false_type { };
+
+template <class C, class D>
+struct _product_term<StreamMultiply<C, D>> : std::true_type {
+  static constexpr StreamMultiply<C, D> const &product(Stream<StreamMultiply<C, D>> const &p) {
+    return static_cast<StreamMultiply<C, D> const &>(p);
+  }
+
+  template <typename R>
+  static constexpr R scale(Stream<StreamMultiply<C, D>> const &) {
+    return R(1);
+  }
+};
+
+template <typename T, class C, class D>
+struct _product_term<StreamElementWiseOperator<multiply_st<T>, StreamMultiply<C, D>>>
+    : std::true_type {
+  typedef StreamElementWiseOperator<multiply_st<T>, StreamMultiply<C, D>> type;
+
+  static constexpr StreamMultiply<C, D> const &product(Stream<type> const &p) {
+    return static_cast<StreamMultiply<C, D> const &>(static_cast<type const &>(p).template argument<0>());
+  }
+
+  template <typename R>
+  static constexpr R scale(Stream<type> const &p) {
+    return R(static_cast<type const &>(p).functor().t);
+  }
+};
+
+/** @brief Splits an affine expression into its product and addend terms.
+ *
+ *  @tparam C  Expression type.
+ *  @tparam D  Product term's type.
+ *  @tparam E  Addend term's type.
+ *  @tparam IP Index of the product term's argument.
+ *  @tparam SP Sign of the product term.
+ *  @tparam SY Sign of the addend term.
+ *
+ *  @sa internal::_affine
+ */
+template <class C, class D, class E, size_t IP, int SP, int SY>
+struct _affine_terms : std::true_type {
+  typedef _product_term<D> P;
+  typedef _scaled<E> Y;
+
+  static constexpr auto const &product(C const &c) {
+    return P::product(c.template argument<IP>());
+  }
+
+  static constexpr auto const &addend(C const &c) {
+    return Y::unscaled(c.template argument<1 - IP>());
+  }
+
+  template <typename R>
+  static constexpr R alpha(C const &c) {
+    return R(SP) * P::template scale<R>(c.template argument<IP>());
+  }
+
+  template <typename R>
+  static constexpr R beta(C const &c) {
+    return R(SY) * Y::template scale<R>(c.template argument<1 - IP>());
+  }
+};
+
+/** @brief Tests if a tensor stream is an affine expression of a matrix
+ *         product.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Affine expressions are sums and differences of a product term, as defined by
+ *  internal::_product_term, and any other stream. The other stream may itself
+ *  be scaled by a scalar. Examples include `A * x + b`, `b - A * x`, and
+ *  `alpha * A * B + beta * C`.
+ *
+ *  Such expressions can be evaluated in a single pass with fused multiply adds
+ *  rather than calling back into the product for each element.
+ *
+ *  @sa internal::StreamElementWiseOperator::eval_to
+ *  @sa internal::StreamMultiply::eval_to
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <class C, typename>
+struct _affine : std::false_type { };
+
+template <class C, class D>
+struct _affine<StreamElementWiseOperator<add, C, D>, std::enable_if_t<
+    _product_term<C>::value>>
+    : _affine_terms<StreamElementWiseOperator<add, C, D>, C, D, 0, 1, 1> { };
+
+template <class C, class D>
+struct _affine<StreamElementWiseOperator<add, C, D>, std::enable_if_t<
+    !_product_term<C>::value && _product_term<D>::value>>
+    : _affine_terms<StreamElementWiseOperator<add, C, D>, D, C, 1, 1, 1> { };
+
+template <class C, class D>
+struct _affine<StreamElementWiseOperator<subtract, C, D>, std::enable_if_t<
+    _product_term<C>::value>>
+    : _affine_terms<StreamElementWiseOperator<subtract, C, D>, C, D, 0, 1, -1> { };
+
+template <class C, class D>
+struct _affine<StreamElementWiseOperator<subtract, C, D>, std::enable_if_t<
+    !_product_term<C>::value && _product_term<D>::value>>
+    : _affine_terms<StreamElementWiseOperator<subtract, C, D>, D, C, 1, -1, 1> { };
+
 }  // namespace internal
 }  // namespace lin
 
@@ -6,7 +6,14 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "../types/mapping.hpp"
 #include "../types/stream.hpp"
+#include "functors.hpp"
+#include "gemm.hpp"
+
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 
 #ifndef LIN_CORE_OPERATIONS_STREAM_MULTIPLY_HPP_
 #define LIN_CORE_OPERATIONS_STREAM_MULTIPLY_HPP_
@@ -24,25 +31,124 @@ struct can_multiply<C, D, std::enable_if_t<(
     (_dims<C>::max_cols == _dims<D>::max_rows)
   )>> : std::true_type { };
 
+template <class C, typename = void>
+struct _lazy_product : std::false_type { };
+
+/** @brief Tests if a tensor stream lazily evaluates a matrix product.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  True for internal::StreamMultiply and for any lazily evaluated expression
+ *  with a product somewhere among its arguments. Accessing a single element of
+ *  such a stream costs a dot product rather than a constant amount of work.
+ *
+ *  @sa internal::StreamMultiply
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <class C>
+struct has_lazy_product : _lazy_product<C> { };
+
+template <class F, class... Cs>
+class StreamElementWiseOperator;
+
+/** @brief Splits a tensor stream into a scalar factor and an unscaled stream.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Streams of the form `t * A`, or `A * t`, are split into the scalar `t` and
+ *  the stream `A`. Any other stream is its own unscaled stream with a factor of
+ *  one and the specialization derives from `std::false_type`.
+ *
+ *  This lets matrix products pull scalar factors out of their operands and
+ *  apply them once per element of the result rather than evaluating scaled
+ *  copies of the operands.
+ *
+ *  @sa internal::StreamMultiply
+ *
+ *  @ingroup COREOPERATIONS
+ */
+template <class C, typename = void>
+struct _scaled : std::false_type {
+  typedef C type;
+
+  static constexpr Stream<C> const &unscaled(Stream<C> const &c) {
+    return c;
+  }
+
+  template <typename R>
+  static constexpr R scale(Stream<C> const &) {
+    return R(1);
+  }
+};
+
+template <typename T, class C>
+struct _scaled<StreamElementWiseOperator<multiply_st<T>, C>> : std::true_type {
+  typedef C type;
+
+  static constexpr Stream<C> const &unscaled(Stream<StreamElementWiseOperator<multiply_st<T>, C>> const &c) {
+    return static_cast<StreamElementWiseOperator<multiply_st<T>, C> const &>(c).template argument<0>();
+  }
+
+  template <typename R>
+  static constexpr R scale(Stream<StreamElementWiseOperator<multiply_st<T>, C>> const &c) {
+    return R(static_cast<StreamElementWiseOperator<multiply_st<T>, C> const &>(c).functor().t);
+  }
+};
+
 /** @brief Proxy to a lazily evalutated tensor multiplication operation.
  * 
  *  @tparam C %Tensor type.
  *  @tparam D %Tensor type.
  * 
- *  Details to come...
+ *  Individual elements are lazily evaluated as dot products of a row and a
+ *  column. When the entire product is assigned to a mapping, it's instead
+ *  evaluated with the blocked internal::gemm kernel.
+ *
+ *  Each element of a product reads an entire row of the left operand and an
+ *  entire column of the right one. If an operand is itself a lazily evaluated
+ *  product, see internal::has_lazy_product, it's therefore evaluated once into
+ *  a temporary held by this proxy rather than having its elements recomputed
+ *  on every access. The `LIN_MATERIALIZE_HOOK` macro is invoked whenever this
+ *  happens.
  * 
  *  @ingroup COREOPERATIONS
  */
 template <class C, class D>
 class StreamMultiply : public Stream<StreamMultiply<C, D>> {
  private:
+  /** @brief Operand held by this proxy.
+   *
+   *  Either a reference to the stream itself or, if it contains a lazily
+   *  evaluated product, its value.
+   */
+  template <class E>
+  using operand_t = std::conditional_t<has_lazy_product<E>::value,
+      traits_eval_t<E>, E>;
+
+  /** @brief Stores an operand's value if it contains a lazy product.
+   */
+  template <class E>
+  using operand_storage_t = std::conditional_t<has_lazy_product<E>::value,
+      traits_eval_t<E> const, Stream<E> const &>;
+
+  /** @brief Reports an operand evaluated into a temporary.
+   */
+  template <class E>
+  static constexpr void materialized(Stream<E> const &e, std::true_type) {
+    LIN_MATERIALIZE_HOOK(E, e.rows(), e.cols());
+  }
+
+  template <class E>
+  static constexpr void materialized(Stream<E> const &, std::false_type) { }
+
   /** @brief %Tensor stream.
    */
-  Stream<C> const &c;
+  operand_storage_t<C> c;
 
   /** @brief %Tensor stream.
    */
-  Stream<D> const &d;
+  operand_storage_t<D> d;
 
  public:
   /** @brief Traits information for this type.
@@ -72,6 +178,9 @@ class StreamMultiply : public Stream<StreamMultiply<C, D>> {
   constexpr StreamMultiply(Stream<C> const &c, Stream<D> const &d)
   : c(c), d(d) {
     LIN_ASSERT(c.cols() == d.rows());
+
+    materialized(c, has_lazy_product<C>());
+    materialized(d, has_lazy_product<D>());
   }
 
   /** @return Number of rows in the tensor.
@@ -99,9 +208,86 @@ class StreamMultiply : public Stream<StreamMultiply<C, D>> {
    *  @sa internal::Stream::eval
    */
   constexpr typename Traits::elem_t operator()(size_t i, size_t j) const {
-    typename Traits::elem_t x = c(i, 0) * d(0, j);
-    for (size_t k = 1; k < c.cols(); k++) x += c(i, k) * d(k, j);
-    return x;
+    return element(i, j, unroll_t<unrolled::value, _dims<C>::cols - 1>());
+  }
+
+  /** @brief Evaluates the entire product into a mapping.
+   *
+   *  @param m Destination mapping.
+   *
+   *  Small, fixed size products are evaluated with straight line code unless
+   *  the destination is symmetric. Otherwise, operands that aren't value
+   *  backed, and weren't already evaluated on construction, are first
+   *  evaluated into temporaries.
+   *
+   *  This is called by internal::Mapping::operator=(Stream<C> const &) and
+   *  shouldn't need to be called directly.
+   *
+   *  The destination must not reference either operand's elements. Assignment
+   *  operators route through a temporary when it does.
+   *
+   *  @sa internal::StreamMultiply::aliases
+   *  @sa internal::gemm
+   *  @sa internal::PackedStream
+   */
+  template <class E>
+  constexpr void eval_to(Mapping<E> &m) const {
+    LIN_ASSERT(m.rows() == rows());
+    LIN_ASSERT(m.cols() == cols());
+
+    evaluate(m, gemm_serial(), unroll_t<unrolled_to<E>::value, Traits::size>());
+  }
+
+  /** @brief Evaluates the entire product into a mapping with the provided
+   *         matrix multiplication driver.
+   *
+   *  @param m Destination mapping.
+   *  @param g Driver.
+   *
+   *  Behaves like internal::StreamMultiply::eval_to(Mapping<E> &) const except
+   *  the packed operands are multiplied by `g.run` rather than internal::gemm.
+   *  Small, fixed size products are still evaluated with straight line code.
+   *
+   *  @sa internal::gemm_serial
+   */
+  template <class E, class G>
+  constexpr void eval_to(Mapping<E> &m, G const &g) const {
+    LIN_ASSERT(m.rows() == rows());
+    LIN_ASSERT(m.cols() == cols());
+
+    evaluate(m, g, unroll_t<unrolled_to<E>::value, Traits::size>());
+  }
+
+  /** @brief Evaluates an affine expression of the product into a mapping.
+   *
+   *  @param m     Destination mapping.
+   *  @param alpha Scalar factor of the product.
+   *  @param beta  Scalar factor of the addend.
+   *  @param y     Addend.
+   *
+   *  Computes `alpha * (*this) + beta * y` in a single pass. Each element of the
+   *  product is accumulated with fused multiply adds and combined with the
+   *  addend as soon as it's complete. If the addend itself lazily evaluates a
+   *  product, it's first evaluated straight into the destination.
+   *
+   *  This is called when assigning affine element wise expressions such as
+   *  `A * x + b` and shouldn't need to be called directly.
+   *
+   *  The destination must not reference either operand's elements. It may be
+   *  the addend.
+   *
+   *  @sa internal::gemm_affine
+   *  @sa internal::fmadd
+   */
+  template <class E, class Y>
+  constexpr void eval_to(Mapping<E> &m, typename Traits::elem_t const &alpha,
+      typename Traits::elem_t const &beta, Stream<Y> const &y) const {
+    LIN_ASSERT(m.rows() == rows());
+    LIN_ASSERT(m.cols() == cols());
+    LIN_ASSERT(y.rows() == rows());
+    LIN_ASSERT(y.cols() == cols());
+
+    evaluate(m, alpha, beta, y, unroll_t<unrolled_to<E>::value, Traits::size>());
   }
 
   /** @brief Lazily evaluates the requested tensor element.
@@ -111,7 +297,8 @@ class StreamMultiply : public Stream<StreamMultiply<C, D>> {
    *  @return Resulting value of the tensor element.
    * 
    *  Element access proceeds as if all the elements of the tensor stream were
-   *  flattened into an array in row major order.
+   *  flattened into an array in row major order. Vector products are indexed
+   *  without a division.
    * 
    *  You may want to consider for the creation of a value backed type to reduce
    *  overhead.
@@ -119,10 +306,144 @@ class StreamMultiply : public Stream<StreamMultiply<C, D>> {
    *  @sa internal::Stream::eval
    */
   constexpr typename Traits::elem_t operator()(size_t i) const {
+    if (is_col_vector<StreamMultiply<C, D>>::value) return (*this)(i, 0);
+    if (is_row_vector<StreamMultiply<C, D>>::value) return (*this)(0, i);
     return (*this)(i / cols(), i % cols());
   }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r Region about to be written.
+   *
+   *  @return True if either operand overlaps the region.
+   *
+   *  Every element of the product reads an entire row and column of the
+   *  operands so any overlap at all is unsafe.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool) const {
+    return c.aliases(r, false) || d.aliases(r, false);
+  }
+
+ private:
+  /** @brief Whether both operands are small enough to fully unroll the
+   *         product.
+   *
+   *  @sa internal::is_unrollable
+   */
+  using unrolled = conjunction<is_unrollable<C>, is_unrollable<D>>;
+
+  /** @brief Whether the product is evaluated into a destination with straight
+   *         line code.
+   *
+   *  Symmetric destinations are always evaluated with the blocked kernel which
+   *  only computes their lower triangle.
+   *
+   *  @sa internal::is_symmetric
+   */
+  template <class E>
+  using unrolled_to = conjunction<unrolled, negation<is_symmetric<E>>>;
+
+  /** @brief Computes an element as a dot product with a loop.
+   */
+  constexpr typename Traits::elem_t element(size_t i, size_t j, std::false_type) const {
+    typename Traits::elem_t x = c(i, 0) * d(0, j);
+    for (size_t k = 1; k < c.cols(); k++) x = fmadd(c(i, k), d(k, j), x);
+    return x;
+  }
+
+  /** @brief Computes an element as an unrolled dot product.
+   */
+  template <size_t... K>
+  constexpr typename Traits::elem_t element(size_t i, size_t j, std::index_sequence<K...>) const {
+    typename Traits::elem_t x = c(i, 0) * d(0, j);
+    (void) std::initializer_list<int>{ (x = fmadd(c(i, K + 1), d(K + 1, j), x), 0)... };
+    return x;
+  }
+
+  /** @return Product of the scalar factors pulled out of the operands.
+   *
+   *  @sa internal::_scaled
+   */
+  constexpr typename Traits::elem_t scale() const {
+    return _scaled<operand_t<C>>::template scale<typename Traits::elem_t>(c) *
+        _scaled<operand_t<D>>::template scale<typename Traits::elem_t>(d);
+  }
+
+  /** @brief Runs the blocked kernel with the provided epilogue.
+   *
+   *  Only the unscaled operands are packed, into the driver's `packed_t`. The epilogue is responsible for
+   *  applying internal::StreamMultiply::scale.
+   */
+  template <class E, class G, class F>
+  constexpr void multiply_to(Mapping<E> &m, G const &g, F const &f) const {
+    typedef _scaled<operand_t<C>> SC;
+    typedef _scaled<operand_t<D>> SD;
+
+    typename G::template packed_t<typename SC::type> const a(SC::unscaled(c));
+    typename G::template packed_t<typename SD::type> const b(SD::unscaled(d));
+    g.template run<typename Traits::elem_t>(rows(), cols(), c.cols(), a.data(),
+        a.stride(), b.data(), b.stride(), m, f);
+  }
+
+  /** @brief Evaluates the product into a mapping with the provided driver.
+   */
+  template <class E, class G>
+  constexpr void evaluate(Mapping<E> &m, G const &g, std::false_type) const {
+    if (_scaled<operand_t<C>>::value || _scaled<operand_t<D>>::value)
+      multiply_to(m, g, gemm_scale<typename Traits::elem_t>{scale()});
+    else
+      multiply_to(m, g, gemm_store());
+  }
+
+  /** @brief Evaluates an affine expression of the product into a mapping with
+   *         the blocked kernel.
+   */
+  template <class E, class Y>
+  constexpr void evaluate(Mapping<E> &m, typename Traits::elem_t const &alpha,
+      typename Traits::elem_t const &beta, Stream<Y> const &y, std::false_type) const {
+    typedef typename Traits::elem_t R;
+
+    if (has_lazy_product<Y>::value) {
+      MappingNoAlias<E>{m} = y;
+      multiply_to(m, gemm_serial(), gemm_affine<R, E>{alpha * scale(), beta, m});
+    } else {
+      multiply_to(m, gemm_serial(), gemm_affine<R, Y>{alpha * scale(), beta, y});
+    }
+  }
+
+  /** @brief Evaluates an affine expression of the product into a mapping with
+   *         straight line code.
+   */
+  template <class E, class Y, size_t... I>
+  constexpr void evaluate(Mapping<E> &m, typename Traits::elem_t const &alpha,
+      typename Traits::elem_t const &beta, Stream<Y> const &y, std::index_sequence<I...>) const {
+    (void) std::initializer_list<int>{
+        (m(I) = fmadd(alpha, element(I / Traits::cols, I % Traits::cols,
+            std::make_index_sequence<_dims<C>::cols - 1>()),
+            beta * y(I / Traits::cols, I % Traits::cols)), 0)...
+      };
+  }
+
+  /** @brief Evaluates the product into a mapping with straight line code.
+   */
+  template <class E, class G, size_t... I>
+  constexpr void evaluate(Mapping<E> &m, G const &, std::index_sequence<I...>) const {
+    (void) std::initializer_list<int>{
+        (m(I) = element(I / Traits::cols, I % Traits::cols,
+            std::make_index_sequence<_dims<C>::cols - 1>()), 0)...
+      };
+  }
 };
 
+template <class C, class D>
+struct _linear<StreamMultiply<C, D>> : is_vector<StreamMultiply<C, D>> { };
+
+template <class C, class D>
+struct _lazy_product<StreamMultiply<C, D>> : std::true_type { };
+
 template <class C, class D>
 struct _elem<StreamMultiply<C, D>> {
   typedef typename multiply::template expression<
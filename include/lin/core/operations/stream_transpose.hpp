@@ -7,6 +7,8 @@
 #ifndef LIN_CORE_OPERATIONS_STREAM_TRANSPOSE_HPP_
 #define LIN_CORE_OPERATIONS_STREAM_TRANSPOSE_HPP_
 
+#include "stream_multiply.hpp"
+
 namespace lin {
 namespace internal {
 
@@ -91,6 +93,46 @@ class StreamTranspose : public Stream<StreamTranspose<C>> {
   constexpr typename Traits::elem_t operator()(size_t i) const {
     return (*this)(i / cols(), i % cols());
   }
+
+  /** @brief Lazily evaluates a packet of tensor elements.
+   *
+   *  @tparam N Number of lanes.
+   *
+   *  @param i Offset of the first element.
+   *
+   *  @return Packet holding the resulting values of the elements at offsets `i`
+   *          through `i + N - 1`.
+   *
+   *  A row major tensor's storage is also the storage of its transpose in column
+   *  major order and vice versa. Packets are therefore forwarded untouched and
+   *  only the layout is flipped. This makes transposing into a destination of
+   *  the opposite layout a contiguous copy.
+   *
+   *  @sa internal::has_packet_access
+   *  @sa internal::packet_stride
+   */
+  template <size_t N>
+  constexpr Packet<typename Traits::elem_t, N> packet(size_t i) const {
+    return c.template packet<N>(i);
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if the underlying stream aliases the transposed region.
+   *
+   *  Element `(i, j)` of the transpose is element `(j, i)` of the underlying
+   *  stream so the check is forwarded with the region transposed.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return c.aliases(r.transpose(), positional);
+  }
 };
 
 template <class C>
@@ -103,6 +145,18 @@ struct _dims<StreamTranspose<C>> {
   static constexpr size_t max_rows = _dims<C>::max_cols;
   static constexpr size_t max_cols = _dims<C>::max_rows;
 };
+
+template <class C>
+struct _layout<StreamTranspose<C>> : _transposed_layout<typename _layout<C>::type> { };
+
+template <class C>
+struct _packet<StreamTranspose<C>> : std::integral_constant<bool, _packet<C>::value> {
+  static constexpr size_t stride = _packet<C>::stride;
+  typedef typename _transposed_layout<typename _packet<C>::layout>::type layout;
+};
+
+template <class C>
+struct _lazy_product<StreamTranspose<C>> : has_lazy_product<C> { };
 }  // namespace internal
 }  // namespace lin
 
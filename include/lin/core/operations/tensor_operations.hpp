@@ -12,10 +12,13 @@
 #include "../types.hpp"
 #include "functors.hpp"
 #include "mapping_transpose.hpp"
+#include "reductions.hpp"
 #include "stream_element_wise_operator.hpp"
 #include "stream_transpose.hpp"
 
+#include <initializer_list>
 #include <type_traits>
+#include <utility>
 
 namespace lin {
 namespace internal {
@@ -131,6 +134,33 @@ template <typename T, typename U>
 struct matches_scalar_scalar
     : conjunction<matches_scalar<T>, matches_scalar<U>> { };
 
+template <class C>
+constexpr auto _fro(Stream<C> const &c, std::false_type) {
+  return reduce<traits_elem_t<C>>(reduce_square(), c);
+}
+
+template <class C, size_t... I>
+constexpr auto _fro(Stream<C> const &c, std::index_sequence<I...>) {
+  constexpr size_t K = C::Traits::cols;
+  typename C::Traits::elem_t f = c(0, 0) * c(0, 0);
+  (void) std::initializer_list<int>{
+      (f += c((I + 1) / K, (I + 1) % K) * c((I + 1) / K, (I + 1) % K), 0)... };
+  return f;
+}
+
+template <class C>
+constexpr auto _sum(Stream<C> const &c, std::false_type) {
+  return reduce<traits_elem_t<C>>(reduce_sum(), c);
+}
+
+template <class C, size_t... I>
+constexpr auto _sum(Stream<C> const &c, std::index_sequence<I...>) {
+  constexpr size_t K = C::Traits::cols;
+  typename C::Traits::elem_t x = c(0, 0);
+  (void) std::initializer_list<int>{ (x += c((I + 1) / K, (I + 1) % K), 0)... };
+  return x;
+}
+
 }  // namespace internal
 
 /** @weakgroup COREOPERATIONS
@@ -206,9 +236,8 @@ inline constexpr auto divide(T const &t, U const &u) {
 template <class C, std::enable_if_t<
     internal::matches_tensor<C>::value, size_t> = 0>
 constexpr auto fro(internal::Stream<C> const &c) {
-  typename C::Traits::elem_t f = c(0) * c(0);
-  for (size_t i = 1; i < c.size(); i++) f += c(i) * c(i);
-  return f;
+  return internal::_fro(c, internal::unroll_t<
+      internal::is_unrollable<C>::value, C::Traits::size - 1>());
 }
 
 template <typename T, std::enable_if_t<
@@ -256,6 +285,18 @@ inline constexpr auto negate(T const &t) {
   return internal::negate()(t);
 }
 
+template <class C, std::enable_if_t<
+    internal::matches_tensor<C>::value, size_t> = 0>
+constexpr auto noalias(internal::Mapping<C> &c) {
+  return internal::MappingNoAlias<C>(c);
+}
+
+template <class C, std::enable_if_t<
+    internal::matches_tensor<C>::value, size_t> = 0>
+constexpr auto noalias(internal::Mapping<C> &&c) {
+  return internal::MappingNoAlias<C>(c);
+}
+
 template <class C, std::enable_if_t<
     internal::matches_tensor<C>::value, size_t> = 0>
 inline constexpr auto sign(internal::Stream<C> const &c) {
@@ -309,9 +350,8 @@ inline constexpr auto subtract(T const &t, U const &u) {
 
 template <class C>
 constexpr auto sum(internal::Stream<C> const &c) {
-  typename C::Traits::elem_t x = c(0);
-  for (lin::size_t i = 1; i < c.size(); i++) x += c(i);
-  return x;
+  return internal::_sum(c, internal::unroll_t<
+      internal::is_unrollable<C>::value, C::Traits::size - 1>());
 }
 
 template <class C, std::enable_if_t<
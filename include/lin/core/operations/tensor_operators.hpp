@@ -18,6 +18,32 @@
 namespace lin {
 namespace internal {
 
+template <class D, class C>
+constexpr void _multiply_in_place(Mapping<D> &m, Stream<C> const &c, std::false_type) {
+  typedef traits_elem_t<StreamMultiply<D, C>> elem_t;
+
+  // Row i of the product only depends on row i of the mapping so a single row
+  // of scratch is all that's needed. Elements are accumulated in the same order
+  // as internal::gemm so the result matches m = m * c
+  elem_t x[_dims<D>::max_cols] = {};
+  for (size_t i = 0; i < m.rows(); i++) {
+    elem_t const m_i0 = m(i, 0);
+    for (size_t j = 0; j < m.cols(); j++) x[j] = m_i0 * c(0, j);
+    for (size_t k = 1; k < m.cols(); k++) {
+      elem_t const m_ik = m(i, k);
+      for (size_t j = 0; j < m.cols(); j++) x[j] = fmadd(m_ik, c(k, j), x[j]);
+    }
+    for (size_t j = 0; j < m.cols(); j++) m(i, j) = x[j];
+  }
+}
+
+// Runtime sized mappings have no bound on the length of a row so the product
+// is evaluated into a runtime sized temporary instead
+template <class D, class C>
+constexpr void _multiply_in_place(Mapping<D> &m, Stream<C> const &c, std::true_type) {
+  MappingNoAlias<D>{m} = traits_eval_t<StreamMultiply<D, C>>(StreamMultiply<D, C>(m, c));
+}
+
 /** @weakgroup COREOPERATIONS
  *  @{
  */
@@ -101,6 +127,115 @@ inline constexpr auto operator/(Stream<C> const &c, T const &t) {
   return lin::divide(c, t);
 }
 
+/** @brief Adds a tensor to a mapping in place. */
+template <class D, class C, std::enable_if_t<conjunction<
+    matches_tensor_tensor<D, C>, have_same_dimensions<D, C>>::value, size_t> = 0>
+inline constexpr D &operator+=(Mapping<D> &m, Stream<C> const &c) {
+  return m = lin::add(m, c);
+}
+
+/** @brief Adds a tensor to a mapping in place. */
+template <class D, class C, std::enable_if_t<conjunction<
+    matches_tensor_tensor<D, C>, have_same_dimensions<D, C>>::value, size_t> = 0>
+inline constexpr D &operator+=(Mapping<D> &&m, Stream<C> const &c) {
+  return m += c;
+}
+
+/** @brief Adds a scalar to each element of a mapping in place. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator+=(Mapping<D> &m, T const &t) {
+  return m = lin::add(m, t);
+}
+
+/** @brief Adds a scalar to each element of a mapping in place. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator+=(Mapping<D> &&m, T const &t) {
+  return m += t;
+}
+
+/** @brief Subtracts a tensor from a mapping in place. */
+template <class D, class C, std::enable_if_t<conjunction<
+    matches_tensor_tensor<D, C>, have_same_dimensions<D, C>>::value, size_t> = 0>
+inline constexpr D &operator-=(Mapping<D> &m, Stream<C> const &c) {
+  return m = lin::subtract(m, c);
+}
+
+/** @brief Subtracts a tensor from a mapping in place. */
+template <class D, class C, std::enable_if_t<conjunction<
+    matches_tensor_tensor<D, C>, have_same_dimensions<D, C>>::value, size_t> = 0>
+inline constexpr D &operator-=(Mapping<D> &&m, Stream<C> const &c) {
+  return m -= c;
+}
+
+/** @brief Subtracts a scalar from each element of a mapping in place. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator-=(Mapping<D> &m, T const &t) {
+  return m = lin::subtract(m, t);
+}
+
+/** @brief Subtracts a scalar from each element of a mapping in place. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator-=(Mapping<D> &&m, T const &t) {
+  return m -= t;
+}
+
+/** @brief Multiplies a mapping in place by a square matrix. */
+template <class D, class C, std::enable_if_t<conjunction<
+    can_multiply<D, C>, is_square<C>, have_same_dimensions<D, StreamMultiply<D, C>>,
+    negation<is_symmetric<D>>
+  >::value, size_t> = 0>
+inline constexpr D &operator*=(Mapping<D> &m, Stream<C> const &c) {
+  LIN_ASSERT(m.cols() == c.rows());
+  LIN_ASSERT(c.rows() == c.cols());
+
+  if (has_lazy_product<C>::value || LIN_CONSTANT_EVALUATED() || c.aliases(m.region(), false))
+    _multiply_in_place(m, traits_eval_t<C>(c), has_dynamic_dimensions<D>());
+  else
+    _multiply_in_place(m, c, has_dynamic_dimensions<D>());
+  return static_cast<D &>(m);
+}
+
+/** @brief Multiplies a mapping in place by a square matrix. */
+template <class D, class C, std::enable_if_t<conjunction<
+    can_multiply<D, C>, is_square<C>, have_same_dimensions<D, StreamMultiply<D, C>>,
+    negation<is_symmetric<D>>
+  >::value, size_t> = 0>
+inline constexpr D &operator*=(Mapping<D> &&m, Stream<C> const &c) {
+  return m *= c;
+}
+
+/** @brief Multiplies each element of a mapping in place by a scalar. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator*=(Mapping<D> &m, T const &t) {
+  return m = lin::multiply(m, t);
+}
+
+/** @brief Multiplies each element of a mapping in place by a scalar. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator*=(Mapping<D> &&m, T const &t) {
+  return m *= t;
+}
+
+/** @brief Divides each element of a mapping in place by a scalar. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator/=(Mapping<D> &m, T const &t) {
+  return m = lin::divide(m, t);
+}
+
+/** @brief Divides each element of a mapping in place by a scalar. */
+template <class D, typename T, std::enable_if_t<
+    matches_tensor_scalar<D, T>::value, size_t> = 0>
+inline constexpr D &operator/=(Mapping<D> &&m, T const &t) {
+  return m /= t;
+}
+
 /** @}
  */
 
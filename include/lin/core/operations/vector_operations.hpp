@@ -13,10 +13,13 @@
 #include "../types/stream.hpp"
 #include "../types/vector.hpp"
 #include "functors.hpp"
+#include "reductions.hpp"
 #include "tensor_operations.hpp"
 
 #include <cmath>
-#include <type_traits> 
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 
 namespace lin {
 namespace internal {
@@ -36,6 +39,20 @@ struct can_dot : conjunction<
 template <class C>
 struct can_norm : is_vector<C> { };
 
+template <class C, class D>
+constexpr auto _dot(Stream<C> const &u, Stream<D> const &v, std::false_type) {
+  return reduce<multiply::expression<_elem_t<C>, _elem_t<D>>>(reduce_product(), u, v);
+}
+
+template <class C, class D, size_t... I>
+constexpr auto _dot(Stream<C> const &u, Stream<D> const &v, std::index_sequence<I...>) {
+  typedef multiply::expression<_elem_t<C>, _elem_t<D>> T;
+
+  T x = u(0) * v(0);
+  (void) std::initializer_list<int>{ (x += u(I + 1) * v(I + 1), 0)... };
+  return x;
+}
+
 }  // namespace internal
 
 template <class C, class D, std::enable_if_t<internal::can_cross<C, D>::value, size_t> = 0>
@@ -57,16 +74,14 @@ template <class C, class D, std::enable_if_t<internal::can_dot<C, D>::value, siz
 constexpr auto dot(internal::Stream<C> const &u, internal::Stream<D> const &v) {
   LIN_ASSERT(u.size() == v.size());
 
-  typedef internal::multiply::expression<internal::_elem_t<C>, internal::_elem_t<D>> T;
-
-  T x = u(0) * v(0);
-  for (size_t i = 1; i < u.size(); i++) x += u(i) * v(i);
-  return x;
+  return internal::_dot(u, v, internal::unroll_t<internal::conjunction<
+      internal::is_unrollable<C>, internal::is_unrollable<D>>::value, C::Traits::size - 1>());
 }
 
 template <class C, std::enable_if_t<internal::can_norm<C>::value, size_t> = 0>
 constexpr auto norm(internal::Stream<C> const &u) {
-  return std::sqrt(fro(u));
+  using std::sqrt;
+  return sqrt(fro(u));
 }
 }  // namespace lin
 
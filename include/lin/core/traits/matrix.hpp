@@ -10,6 +10,8 @@
 #include "utilities.hpp"
 #include "vector.hpp"
 
+#include <type_traits>
+
 namespace lin {
 namespace internal {
 
@@ -26,6 +28,24 @@ namespace internal {
 template <class C>
 struct is_matrix : negation<is_vector<C>> { };
 
+template <class C, typename = void>
+struct _symmetric : std::false_type { };
+
+/** @brief Tests if a tensor type stores a symmetric matrix.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Elements `(i, j)` and `(j, i)` of a symmetric tensor type share storage so
+ *  writing one writes the other. Assignments to such types only evaluate and
+ *  write the lower triangle, diagonal included.
+ *
+ *  @sa SymmetricMatrix
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct is_symmetric : std::integral_constant<bool, _symmetric<C>::value> { };
+
 }  // namespace internal
 }  // namespace lin
 
@@ -10,8 +10,34 @@
 #include "utilities.hpp"
 
 #include <type_traits>
+#include <utility>
 
 namespace lin {
+
+/** @brief Layout tag for tensors stored one row after another.
+ *
+ *  This is the default layout of every value backed type.
+ *
+ *  @sa ColMajor
+ *  @sa internal::traits::layout
+ *
+ *  @ingroup CORETRAITS
+ */
+struct RowMajor { };
+
+/** @brief Layout tag for tensors stored one column after another.
+ *
+ *  Algorithms that mostly walk down columns, say applying Householder
+ *  reflectors or accumulating a Jacobian, see contiguous memory when operating
+ *  on column major types.
+ *
+ *  @sa RowMajor
+ *  @sa internal::traits::layout
+ *
+ *  @ingroup CORETRAITS
+ */
+struct ColMajor { };
+
 namespace internal {
 
 /** @brief Provides a tensor type's element type.
@@ -59,6 +85,51 @@ using _eval_t = typename _eval<C>::type;
 template <class C>
 struct _dims;
 
+/** @brief Provides a specific tensor type's storage layout.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  This is an implementation detail that allows value backed types to request
+ *  an aligned or padded backing array. By default, elements are stored densely
+ *  with their natural alignment.
+ *
+ *  - `align` is the alignment of the backing array in bytes.
+ *  - `stride` is the fixed distance between the start of consecutive rows, or
+ *    columns if column major, or zero if they're stored densely.
+ *  - `size` is the length of the backing array.
+ *  - `layout` is either RowMajor or ColMajor.
+ *
+ *  @sa Storage
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C, typename = void>
+struct _storage {
+  static constexpr size_t align = alignof(_elem_t<C>);
+  static constexpr size_t stride = 0;
+  static constexpr size_t size = _dims<C>::max_rows * _dims<C>::max_cols;
+  typedef RowMajor layout;
+};
+
+/** @brief Provides a specific tensor type's layout tag.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  This is an implementation detail. Value backed types take their layout from
+ *  internal::_storage while references and views forward the layout of the
+ *  elements they access. For other streams, the layout names the order in
+ *  which elements are cheapest to traverse.
+ *
+ *  @sa RowMajor
+ *  @sa ColMajor
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C, typename = void>
+struct _layout {
+  typedef typename _storage<C>::layout type;
+};
+
 /** @brief Collection of compile time information about a specific tensor class.
  *
  *  @tparam C %Tensor type.
@@ -125,6 +196,26 @@ struct traits {
    *  is set as the max row count times the max column count.
    */
   static constexpr size_t max_size = max_rows * max_cols;
+  /** @brief Leading dimension of padded storage.
+   *
+   *  Defines the distance between the start of consecutive rows, or columns for
+   *  column major types, in a value backed tensor's backing array when they're
+   *  padded. If zero, they're stored densely and the leading dimension is the
+   *  column count, or row count for column major types.
+   *
+   *  @sa Storage
+   *  @sa internal::Base::stride
+   */
+  static constexpr size_t stride = _storage<C>::stride;
+
+  /** @brief Storage layout tag.
+   *
+   *  Either RowMajor or ColMajor. Assignments traverse their destination in this
+   *  order so writes are contiguous.
+   *
+   *  @sa internal::is_col_major
+   */
+  typedef typename _layout<C>::type layout;
 };
 
 /** @ingroup TRAITS
@@ -157,6 +248,80 @@ struct _has_traits<C, void_t<typename C::Traits>> : std::true_type { };
 template <class C>
 struct has_traits : _has_traits<C> { };
 
+template <class C>
+using _data_expr = decltype(std::declval<C const &>().data());
+
+/** @brief Tests if a tensor type is value backed.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  A tensor type is determined to be value backed if a constant instance of it
+ *  provides a pointer to its element backing array through a `data()` member.
+ *  This is the case for all types implementing the internal::Base and
+ *  internal::ConstBase interfaces.
+ *
+ *  The elements of a value backed tensor are stored contiguously in the order
+ *  given by internal::traits::layout.
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct is_value_backed : is_detected<_data_expr, C> { };
+
+template <class C, typename = void>
+struct _linear : std::false_type { };
+
+/** @brief Tests if a tensor type is linearly addressable.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  A tensor type is linearly addressable if accessing an element by its flat,
+ *  row major index is no more expensive than by its row and column indices.
+ *  Dense, row major value backed types are, for example, whereas a reference to
+ *  a block of a matrix has to recover the row and column with a division.
+ *
+ *  Assignments and reductions only walk the elements by flat index if every
+ *  tensor involved is linearly addressable. Otherwise, they use nested loops
+ *  over rows and columns.
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct is_linearly_addressable : std::integral_constant<bool, _linear<C>::value> { };
+
+/** @brief Tests if a tensor type is column major.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  @sa internal::traits::layout
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct is_col_major : std::is_same<typename _layout<C>::type, ColMajor> { };
+
+/** @brief Opposite of a layout tag.
+ *
+ *  `void`, the layout of streams that don't depend on storage, is its own
+ *  opposite.
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class L>
+struct _transposed_layout {
+  typedef void type;
+};
+
+template <>
+struct _transposed_layout<RowMajor> {
+  typedef ColMajor type;
+};
+
+template <>
+struct _transposed_layout<ColMajor> {
+  typedef RowMajor type;
+};
+
 /** @brief Tests if a tensor type has a fixed row count.
  *
  *  @tparam C %Tensor type.
@@ -210,6 +375,26 @@ template <class C>
 struct has_fixed_dimensions
     : conjunction<has_fixed_rows<C>, has_fixed_cols<C>> { };
 
+/** @brief Tests if operations on a tensor type should be fully unrolled.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  A tensor type is unrolled if it has fixed dimensions and neither its row nor
+ *  column count exceeds `LIN_UNROLL_MAX_DIMENSION`. Assignments, products, and
+ *  reductions over such types are generated as straight line code.
+ *
+ *  @sa internal::has_fixed_dimensions
+ *  @sa LIN_UNROLL_MAX_DIMENSION
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct is_unrollable : std::integral_constant<bool, (
+    has_fixed_dimensions<C>::value &&
+    (_dims<C>::rows <= LIN_UNROLL_MAX_DIMENSION) &&
+    (_dims<C>::cols <= LIN_UNROLL_MAX_DIMENSION)
+  )> { };
+
 /** @brief Tests is a tensor type has a strictly bounded row count.
  * 
  *  @tparam C %Tensor type.
@@ -263,6 +448,37 @@ struct has_strictly_bounded_dimensions : conjunction<
     has_strictly_bounded_rows<C>, has_strictly_bounded_cols<C>
   > { };
 
+/** @brief Maximum dimension reported by runtime sized tensor types.
+ *
+ *  Tensor types whose elements are allocated at runtime, such as
+ *  DynamicMatrix, report this as their maximum row or column count. It's large
+ *  enough to never limit a real problem while keeping the maximum size of a
+ *  tensor from overflowing.
+ *
+ *  @sa internal::has_dynamic_dimensions
+ *
+ *  @ingroup CORETRAITS
+ */
+constexpr size_t dynamic_dimension = size_t(1) << (4 * sizeof(size_t) - 1);
+
+/** @brief Tests if a tensor type has runtime sized dimensions.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  A tensor type is determined to have runtime sized dimensions if either its
+ *  maximum row or column count is internal::dynamic_dimension. Temporaries of
+ *  such types can't be stored inline and are evaluated to DynamicMatrix,
+ *  DynamicRowVector, or DynamicVector instead.
+ *
+ *  @sa internal::dynamic_dimension
+ *
+ *  @ingroup CORETRAITS
+ */
+template <class C>
+struct has_dynamic_dimensions : std::integral_constant<bool, (
+    (_dims<C>::max_rows == dynamic_dimension) || (_dims<C>::max_cols == dynamic_dimension)
+  )> { };
+
 /** @brief Tests if a tensor type has a bounded row count.
  *
  *  @tparam C %Tensor type.
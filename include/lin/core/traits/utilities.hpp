@@ -7,7 +7,10 @@
 #ifndef LIN_CORE_TRAITS_UTILITIES_HPP_
 #define LIN_CORE_TRAITS_UTILITIES_HPP_
 
+#include "../config.hpp"
+
 #include <type_traits>
+#include <utility>
 
 namespace lin {
 namespace internal {
@@ -91,6 +94,28 @@ template <class C>
 struct negation
     : std::conditional_t<C::value, std::false_type, std::true_type> { };
 
+template <bool B, size_t N>
+struct _unroll {
+  typedef std::false_type type;
+};
+
+template <size_t N>
+struct _unroll<true, N> {
+  typedef std::make_index_sequence<N> type;
+};
+
+/** @brief Selects between an unrolled and a looping implementation.
+ *
+ *  @tparam B Whether to unroll.
+ *  @tparam N Number of unrolled iterations.
+ *
+ *  Maps to `std::make_index_sequence<N>` if `B` is true and `std::false_type`
+ *  otherwise. Algorithms are expected to provide an overload for each which
+ *  lets `N` be ill formed, e.g. underflow, whenever `B` is false.
+ */
+template <bool B, size_t N>
+using unroll_t = typename _unroll<B, N>::type;
+
 }  // namespace internal
 }  // namespace lin
 
@@ -20,7 +20,11 @@
 #include "types/dimensions.hpp"
 #include "types/mapping.hpp"
 #include "types/matrix.hpp"
+#include "types/packet.hpp"
+#include "types/region.hpp"
+#include "types/storage.hpp"
 #include "types/stream.hpp"
+#include "types/symmetric_matrix.hpp"
 #include "types/vector.hpp"
 
 #endif
@@ -11,6 +11,10 @@
 #include "../traits.hpp"
 #include "dimensions.hpp"
 #include "mapping.hpp"
+#include "packet.hpp"
+#include "region.hpp"
+
+#include <type_traits>
 
 namespace lin {
 namespace internal {
@@ -71,8 +75,9 @@ class Base : public Mapping<D>, public Dimensions<D> {
    * 
    *  @returns Pointer to the backing array.
    * 
-   *  The elements of the tensor are layed out in row major order in the backing
-   *  array. They are stored contiguously in memory.
+   *  The elements of the tensor are layed out in the order given by
+   *  internal::traits::layout in the backing array. Consecutive rows, or
+   *  columns if column major, start internal::Base::stride elements apart.
    */
   inline constexpr typename Traits::elem_t *data() {
     return derived().data();
@@ -82,8 +87,9 @@ class Base : public Mapping<D>, public Dimensions<D> {
    * 
    *  @returns Constant pointer to the backing array.
    * 
-   *  The elements of the tensor are layed out in row major order in the backing
-   *  array. They are stored contiguously in memory.
+   *  The elements of the tensor are layed out in the order given by
+   *  internal::traits::layout in the backing array. Consecutive rows, or
+   *  columns if column major, start internal::Base::stride elements apart.
    */
   inline constexpr typename Traits::elem_t const *data() const {
     return const_cast<D &>(derived()).data();
@@ -103,7 +109,7 @@ class Base : public Mapping<D>, public Dimensions<D> {
     LIN_ASSERT(0 <= i && i < rows());
     LIN_ASSERT(0 <= j && j < cols());
 
-    return data()[i * cols() + j];
+    return is_col_major<D>::value ? data()[j * stride() + i] : data()[i * stride() + j];
   }
 
   /** @brief Provides read and write access to tensor elements.
@@ -121,9 +127,70 @@ class Base : public Mapping<D>, public Dimensions<D> {
   constexpr typename Traits::elem_t &operator()(size_t i) {
     LIN_ASSERT(0 <= i && i < size());
 
-    return data()[i];
+    return is_linearly_addressable<D>::value
+        ? data()[i] : (*this)(i / cols(), i % cols());
+  }
+
+  /** @brief Provides read only access to a packet of tensor elements.
+   *
+   *  @tparam N Number of lanes.
+   *
+   *  @param i Offset of the first element in the backing array.
+   *
+   *  @return Packet holding the backing array elements `i` through `i + N - 1`.
+   *
+   *  With densely stored row major elements, this is equivalent to flattening
+   *  all the elements of the tensor into an array in row major order. With
+   *  padded rows or columns, packets may include padding.
+   *
+   *  If the packet extends past the rows in use, lin assertion errors will be
+   *  triggered.
+   *
+   *  @sa internal::packet_stride
+   */
+  template <size_t N>
+  inline constexpr Packet<typename Traits::elem_t, N> packet(size_t i) const {
+    LIN_ASSERT(i + N <= (Traits::stride
+        ? (is_col_major<D>::value ? cols() : rows()) * stride() : size()));
+
+    return packet_load<N>(data() + i);
+  }
+
+  /** @return Leading dimension of the backing array.
+   *
+   *  This is the distance, in elements, between the start of consecutive rows,
+   *  or columns if column major. It's equal to the column count, or row count
+   *  if column major, unless the storage policy pads rows or columns.
+   *
+   *  @sa Storage
+   *  @sa internal::traits::stride
+   */
+  inline constexpr size_t stride() const {
+    return Traits::stride ? Traits::stride : (is_col_major<D>::value ? rows() : cols());
+  }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    return make_region(data(), rows(), cols(), stride(), is_col_major<D>::value);
   }
 };
+
+template <class C>
+struct _linear<C, std::enable_if_t<std::is_base_of<Base<C>, C>::value>>
+    : std::integral_constant<bool, (
+      is_vector<C>::value || (!traits<C>::stride && !is_col_major<C>::value)
+    )> { };
+
+template <class C>
+struct _packet<C, std::enable_if_t<std::is_base_of<Base<C>, C>::value>>
+    : std::true_type {
+  static constexpr size_t stride = traits<C>::stride;
+  typedef typename traits<C>::layout layout;
+};
+
 }  // namespace internal
 }  // namespace lin
 
@@ -9,6 +9,8 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "packet.hpp"
+#include "region.hpp"
 #include "stream.hpp"
 
 #include <initializer_list>
@@ -18,6 +20,12 @@
 namespace lin {
 namespace internal {
 
+template <class D>
+class MappingNoAlias;
+
+template <class D>
+class MappingParallel;
+
 /** @brief %Tensor interface providing read and write access to elements.
  * 
  *  @tparam D Derived type.
@@ -40,10 +48,32 @@ class Mapping : public Stream<D> {
   static_assert(has_valid_traits<D>::value,
       "Derived types to Mapping<...> must have valid traits");
 
+  template <class E>
+  friend class MappingNoAlias;
+
+  template <class E>
+  friend class MappingParallel;
+
  private:
   template <typename T, typename U>
   using assign_expr = decltype(std::declval<T &>() = std::declval<U &>());
 
+  template <class C, class E>
+  using eval_to_expr = decltype(std::declval<C const &>().eval_to(std::declval<Mapping<E> &>()));
+
+  template <class C>
+  using assign_with_eval_to = is_detected<eval_to_expr, C, D>;
+
+  template <class C>
+  using assign_with_packets = have_packet_access<D, C>;
+
+  template <class C>
+  using assign_unrolled = conjunction<
+      negation<assign_with_eval_to<C>>, is_unrollable<D>, negation<is_symmetric<D>>>;
+
+  template <class C>
+  using assign_linearly = conjunction<is_linearly_addressable<D>, is_linearly_addressable<C>>;
+
  public:
   /** @brief Traits information for this type.
    * 
@@ -145,6 +175,32 @@ class Mapping : public Stream<D> {
     return const_cast<D &>(derived())(i);
   }
 
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  Every mapping ultimately writes to the backing array of a value backed
+   *  tensor.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    return derived().region();
+  }
+
+  /** @brief Tests if reading this tensor's elements while writing to a region
+   *         is unsafe.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if the regions overlap other than element for element.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return region_aliases(region(), r, positional);
+  }
+
   /** @brief Copy an initializer list's elements into the tensor's elements.
    * 
    *  @param list Initializer list.
@@ -178,8 +234,15 @@ class Mapping : public Stream<D> {
    * 
    *  If the dimensions of the tensor don't match at runtime, a lin assertion
    *  error will be triggered.
+   *
+   *  The stream is first checked for reads of memory this tensor is about to
+   *  overwrite, say in `x = A * x` or `A = transpose(A)`. Only if it does is the
+   *  stream evaluated into a temporary before being copied in. Use lin::noalias
+   *  to skip the check when the stream is known not to alias. Within constant
+   *  expressions the stream is always evaluated into a temporary.
    * 
    *  @sa internal::have_same_dimensions
+   *  @sa internal::Stream::aliases
    */
   template <class C, std::enable_if_t<conjunction<
       have_same_dimensions<D, C>,
@@ -189,9 +252,253 @@ class Mapping : public Stream<D> {
     LIN_ASSERT(rows() == s.rows());
     LIN_ASSERT(cols() == s.cols());
 
-    for (size_t i = 0; i < size(); i++) (*this)(i) = s(i);
+    if (LIN_CONSTANT_EVALUATED() || s.aliases(region(), true))
+      assign(traits_eval_t<C>(s));
+    else
+      assign(s);
     return derived();
   }
+
+ private:
+  template <class C>
+  constexpr void assign(Stream<C> const &s) {
+    assign(s, unroll_t<assign_unrolled<C>::value, Traits::size>());
+  }
+
+  /** @brief Copies a stream's elements into this tensor with straight line
+   *         code.
+   *
+   *  Selected for small, fixed size tensors. Elements are written in the order
+   *  of this tensor's layout and all indices are compile time constants.
+   *
+   *  @sa internal::is_unrollable
+   */
+  template <class C, size_t... I>
+  constexpr void assign(Stream<C> const &s, std::index_sequence<I...>) {
+    constexpr size_t R = Traits::rows;
+    constexpr size_t K = Traits::cols;
+    if (is_col_major<D>::value)
+      (void) std::initializer_list<int>{ ((*this)(I % R, I / R) = s(I % R, I / R), 0)... };
+    else
+      (void) std::initializer_list<int>{ ((*this)(I / K, I % K) = s(I / K, I % K), 0)... };
+  }
+
+  template <class C>
+  constexpr void assign(Stream<C> const &s, std::false_type) {
+    assign(s, assign_with_eval_to<C>(), assign_with_packets<C>());
+  }
+
+  /** @brief Lets a stream evaluate itself into this tensor.
+   *
+   *  Selected for streams providing an `eval_to` member, such as matrix
+   *  products, which can produce their elements more efficiently all at once
+   *  than one at a time.
+   *
+   *  @sa internal::StreamMultiply::eval_to
+   */
+  template <class C, class P>
+  constexpr void assign(Stream<C> const &s, std::true_type, P) {
+    static_cast<C const &>(s).eval_to(*this);
+  }
+
+  template <class C, class P>
+  constexpr void assign(Stream<C> const &s, std::false_type, P) {
+    assign(s, 0, assign_units<C>(), P());
+  }
+
+  /** @brief Number of units of work in an element by element assignment.
+   *
+   *  Element by element assignments are carried out over a range of units of
+   *  work. A unit is a single element when copying densely stored elements a
+   *  packet at a time and an entire row, or column if column major, otherwise.
+   */
+  template <class C>
+  constexpr size_t assign_units() const {
+    return (assign_with_packets<C>::value && !Traits::stride)
+        ? size() : (is_col_major<D>::value ? cols() : rows());
+  }
+
+  /** @brief Number of units of work any range passed to an element by element
+   *         assignment must start at a multiple of.
+   *
+   *  Ranges starting on a packet boundary load and store the same packets the
+   *  entire assignment would. Each element is therefore computed exactly as it
+   *  would be if the assignment weren't split up.
+   */
+  template <class C>
+  static constexpr size_t assign_grain() {
+    return (assign_with_packets<C>::value && !Traits::stride)
+        ? packet_size<typename Traits::elem_t>::value : 1;
+  }
+
+  /** @brief Copies a range of a stream's elements into this tensor one at a
+   *         time.
+   *
+   *  @param s Other tensor stream.
+   *  @param b First unit of work.
+   *  @param e One past the last unit of work.
+   *
+   *  Elements are copied by flat index only if this tensor and the stream are
+   *  both linearly addressable. Otherwise, nested loops over rows and columns
+   *  avoid recovering each element's row and column with a division. Column
+   *  major tensors are written one column at a time so consecutive writes are
+   *  contiguous. Streams with a different layout than this tensor are copied a
+   *  tile at a time. Symmetric tensors only have the lower triangle of each row
+   *  copied.
+   *
+   *  @sa internal::is_linearly_addressable
+   *  @sa internal::is_symmetric
+   *  @sa internal::Mapping::assign_units
+   *  @sa internal::Mapping::assign_tiled
+   */
+  template <class C>
+  constexpr void assign(Stream<C> const &s, size_t b, size_t e, std::false_type) {
+    if (is_symmetric<D>::value) {
+      for (size_t i = b; i < e; i++)
+        for (size_t j = 0; j <= i; j++) (*this)(i, j) = s(i, j);
+    }
+    else if (is_col_major<D>::value != is_col_major<C>::value) {
+      assign_tiled(s, b, e);
+    }
+    else if (is_col_major<D>::value) {
+      for (size_t j = b; j < e; j++)
+        for (size_t i = 0; i < rows(); i++) (*this)(i, j) = s(i, j);
+    }
+    else if (assign_linearly<C>::value) {
+      for (size_t i = b * cols(); i < e * cols(); i++) (*this)(i) = s(i);
+    }
+    else {
+      for (size_t i = b; i < e; i++)
+        for (size_t j = 0; j < cols(); j++) (*this)(i, j) = s(i, j);
+    }
+  }
+
+  /** @brief Copies a range of a stream's elements into this tensor one tile at
+   *         a time.
+   *
+   *  @param s Other tensor stream.
+   *  @param b First unit of work.
+   *  @param e One past the last unit of work.
+   *
+   *  Selected when this tensor and the stream have different layouts. Elements
+   *  are copied in `LIN_TRANSPOSE_TILE` by `LIN_TRANSPOSE_TILE` tiles so the
+   *  strided reads, or writes, of a tile all hit cache lines that were just
+   *  loaded.
+   *
+   *  @sa LIN_TRANSPOSE_TILE
+   */
+  template <class C>
+  constexpr void assign_tiled(Stream<C> const &s, size_t b, size_t e) {
+    constexpr size_t T = LIN_TRANSPOSE_TILE;
+    constexpr bool col_major = is_col_major<D>::value;
+    size_t const inner = col_major ? rows() : cols();
+    for (size_t i = b; i < e; i += T) {
+      size_t const ie = (e - i < T) ? e : i + T;
+      for (size_t j = 0; j < inner; j += T) {
+        size_t const je = (inner - j < T) ? inner : j + T;
+        for (size_t k = i; k < ie; k++) {
+          for (size_t l = j; l < je; l++) {
+            if (col_major) (*this)(l, k) = s(l, k);
+            else (*this)(k, l) = s(k, l);
+          }
+        }
+      }
+    }
+  }
+
+  /** @brief Copies a range of a stream's elements into this tensor a packet at
+   *         a time.
+   *
+   *  @param s Other tensor stream.
+   *  @param b First unit of work.
+   *  @param e One past the last unit of work.
+   *
+   *  Only selected when both this tensor and the stream support packet access
+   *  with the same stride and layout. Elements are copied in the order they're
+   *  stored and those past the last full packet are copied one at a time.
+   *
+   *  With padded rows, or columns if column major, each is copied separately
+   *  and packets may spill into the padding, which avoids the scalar tail
+   *  altogether if the stride is a multiple of the packet size.
+   *
+   *  @sa internal::has_packet_access
+   *  @sa internal::packet_stride
+   *  @sa internal::Mapping::assign_units
+   */
+  template <class C>
+  constexpr void assign(Stream<C> const &s, size_t b, size_t e, std::true_type) {
+    constexpr size_t N = packet_size<typename Traits::elem_t>::value;
+    constexpr bool col_major = is_col_major<D>::value;
+    typename Traits::elem_t *const elems = derived().data();
+    if (!Traits::stride) {
+      size_t const n = e - (e - b) % N;
+      size_t i = b;
+      for (; i < n; i += N) packet_store(elems + i, s.template packet<N>(i));
+      for (; i < e; i++) elems[i] = col_major ? s(i % rows(), i / rows()) : s(i);
+    }
+    else {
+      size_t const inner = col_major ? rows() : cols();
+      for (size_t i = b; i < e; i++) {
+        size_t const k = i * Traits::stride;
+        size_t j = 0;
+        for (; j < inner && j + N <= Traits::stride; j += N)
+          packet_store(elems + k + j, s.template packet<N>(k + j));
+        for (; j < inner; j++) elems[k + j] = col_major ? s(j, i) : s(i, j);
+      }
+    }
+  }
+};
+
+/** @brief Proxy assigning to a mapping without checking for aliasing.
+ *
+ *  @tparam D Destination type.
+ *
+ *  @sa noalias
+ *
+ *  @ingroup CORETYPES
+ */
+template <class D>
+class MappingNoAlias {
+ private:
+  template <typename T, typename U>
+  using assign_expr = decltype(std::declval<T &>() = std::declval<U &>());
+
+  /** @brief Destination.
+   */
+  Mapping<D> &m;
+
+ public:
+  constexpr MappingNoAlias() = delete;
+  constexpr MappingNoAlias(MappingNoAlias<D> const &) = default;
+  constexpr MappingNoAlias(MappingNoAlias<D> &&) = default;
+
+  /** @brief Constructs a proxy to the destination of an assignment.
+   *
+   *  @param m Destination.
+   */
+  constexpr MappingNoAlias(Mapping<D> &m)
+  : m(m) { }
+
+  /** @brief Copies a stream's elements into the destination.
+   *
+   *  @param s Other tensor stream.
+   *
+   *  @return Reference to the destination.
+   *
+   *  Behaves just like internal::Mapping::operator=(Stream<C> const &) except
+   *  the stream is assumed not to read any of the destination's elements.
+   */
+  template <class C, std::enable_if_t<conjunction<
+      have_same_dimensions<D, C>,
+      is_detected<assign_expr, traits_elem_t<D>, traits_elem_t<C>>
+    >::value, size_t> = 0>
+  constexpr D &operator=(Stream<C> const &s) {
+    LIN_ASSERT(m.rows() == s.rows());
+    LIN_ASSERT(m.cols() == s.cols());
+
+    m.assign(s);
+    return m.derived();
+  }
 };
 }  // namespace internal
 }  // namespace lin
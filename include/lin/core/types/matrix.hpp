@@ -9,6 +9,7 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "storage.hpp"
 #include "tensor.hpp"
 
 #include <type_traits>
@@ -22,6 +23,7 @@ namespace lin {
  *  @tparam C  Columns at compile time.
  *  @tparam MR Maximum rows at compile time.
  *  @tparam MC Maximum columns at compile time.
+ *  @tparam S  Storage policy.
  * 
  *  The template parameters specify the matrix's traits. The traits must qualify
  *  this type as a matrix.
@@ -31,9 +33,9 @@ namespace lin {
  *
  *  @ingroup CORETYPES
  */
-template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C>
-class Matrix : public internal::Tensor<Matrix<T, R, C, MR, MC>> {
-  static_assert(internal::is_matrix<Matrix<T, R, C, MR, MC>>::value,
+template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C, class S = Storage<>>
+class Matrix : public internal::Tensor<Matrix<T, R, C, MR, MC, S>> {
+  static_assert(internal::is_matrix<Matrix<T, R, C, MR, MC, S>>::value,
       "Invalid Matrix<...> parameters");
 
  public:
@@ -41,27 +43,28 @@ class Matrix : public internal::Tensor<Matrix<T, R, C, MR, MC>> {
    * 
    *  @sa internal::traits
    */
-  typedef internal::traits<Matrix<T, R, C, MR, MC>> Traits;
+  typedef internal::traits<Matrix<T, R, C, MR, MC, S>> Traits;
 
  protected:
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::derived;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::derived;
 
  public:
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::Tensor;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::rows;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::cols;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::size;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::data;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::eval;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::resize;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::operator=;
-  using internal::Tensor<Matrix<T, R, C, MR, MC>>::operator();
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::Tensor;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::rows;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::cols;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::size;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::data;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::stride;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::eval;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::resize;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::operator=;
+  using internal::Tensor<Matrix<T, R, C, MR, MC, S>>::operator();
 
   constexpr Matrix() = default;
-  constexpr Matrix(Matrix<T, R, C, MR, MC> const &) = default;
-  constexpr Matrix(Matrix<T, R, C, MR, MC> &&) = default;
-  constexpr Matrix<T, R, C, MR, MC> &operator=(Matrix<T, R, C, MR, MC> const &) = default;
-  constexpr Matrix<T, R, C, MR, MC> &operator=(Matrix<T, R, C, MR, MC> &&) = default;
+  constexpr Matrix(Matrix<T, R, C, MR, MC, S> const &) = default;
+  constexpr Matrix(Matrix<T, R, C, MR, MC, S> &&) = default;
+  constexpr Matrix<T, R, C, MR, MC, S> &operator=(Matrix<T, R, C, MR, MC, S> const &) = default;
+  constexpr Matrix<T, R, C, MR, MC, S> &operator=(Matrix<T, R, C, MR, MC, S> &&) = default;
 };
 
 /** @weakgroup CORETYPES
@@ -74,12 +77,13 @@ class Matrix : public internal::Tensor<Matrix<T, R, C, MR, MC>> {
  *  @tparam C  Columns at compile time.
  *  @tparam MR Maximum rows.
  *  @tparam MC Maximum columns.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa Matrix
  */
-template <size_t R, size_t C, size_t MR = R, size_t MC = C>
-using Matrixf = Matrix<float, R, C, MR, MC>;
+template <size_t R, size_t C, size_t MR = R, size_t MC = C, class S = Storage<>>
+using Matrixf = Matrix<float, R, C, MR, MC, S>;
 
 typedef Matrixf<2, 2> Matrix2x2f; ///< Two by two float matrix.
 typedef Matrixf<3, 2> Matrix3x2f; ///< Three by two float matrix.
@@ -97,12 +101,13 @@ typedef Matrixf<4, 4> Matrix4x4f; ///< Four by four float matrix.
  *  @tparam C  Columns at compile time.
  *  @tparam MR Maximum rows.
  *  @tparam MC Maximum columns.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa Matrix
  */
-template <size_t R, size_t C, size_t MR = R, size_t MC = C>
-using Matrixd = Matrix<double, R, C, MR, MC>;
+template <size_t R, size_t C, size_t MR = R, size_t MC = C, class S = Storage<>>
+using Matrixd = Matrix<double, R, C, MR, MC, S>;
 
 typedef Matrixd<2, 2> Matrix2x2d; ///< Two by two double matrix.
 typedef Matrixd<3, 2> Matrix3x2d; ///< Three by two double matrix.
@@ -119,21 +124,25 @@ typedef Matrixd<4, 4> Matrix4x4d; ///< Four by four double matrix.
 
 namespace internal {
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _elem<Matrix<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class S>
+struct _elem<Matrix<T, R, C, MR, MC, S>> {
   typedef T type;
 };
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _dims<Matrix<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class S>
+struct _dims<Matrix<T, R, C, MR, MC, S>> {
   static constexpr size_t rows = R;
   static constexpr size_t cols = C;
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
 
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class S>
+struct _storage<Matrix<T, R, C, MR, MC, S>> : _storage_policy<T, R, C, MR, MC, S> { };
+
 template <class C>
-struct _eval<C, std::enable_if_t<is_matrix<C>::value>> {
+struct _eval<C, std::enable_if_t<conjunction<
+    is_matrix<C>, negation<has_dynamic_dimensions<C>>>::value>> {
   typedef Matrix<
       _elem_t<C>,
       _dims<C>::rows,
@@ -0,0 +1,255 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/types/packet.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_TYPES_PACKET_HPP_
+#define LIN_CORE_TYPES_PACKET_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @brief Fixed length group of contiguous tensor elements.
+ *
+ *  @tparam T Element type.
+ *  @tparam N Number of elements.
+ *
+ *  Packets are the unit of work when a stream is evaluated through the packet
+ *  access path. Each lane holds the value of one element of the stream in the
+ *  order the elements are stored. All operations on a packet are straight
+ *  line loops over a compile time number of lanes which compilers readily
+ *  lower to vector instructions.
+ *
+ *  @sa internal::has_packet_access
+ *  @sa internal::Stream::packet
+ *
+ *  @ingroup CORETYPES
+ */
+template <typename T, size_t N>
+struct Packet {
+  static_assert(N > 0, "Packet<...> must contain at least one lane");
+
+  /** @brief Lane values.
+   */
+  T lanes[N];
+
+  /** @param k Lane index.
+   *
+   *  @return Reference to the lane's value.
+   */
+  inline constexpr T &operator[](size_t k) {
+    return lanes[k];
+  }
+
+  /** @param k Lane index.
+   *
+   *  @return Constant reference to the lane's value.
+   */
+  inline constexpr T const &operator[](size_t k) const {
+    return lanes[k];
+  }
+};
+
+/** @brief Number of lanes in a packet of the given element type.
+ *
+ *  @tparam T Element type.
+ *
+ *  Chosen so a packet spans `LIN_PACKET_BYTES` bytes and always contains at
+ *  least one lane.
+ *
+ *  @sa LIN_PACKET_BYTES
+ *
+ *  @ingroup CORETYPES
+ */
+template <typename T>
+struct packet_size : std::integral_constant<size_t, (
+    (LIN_PACKET_BYTES / sizeof(T)) ? (LIN_PACKET_BYTES / sizeof(T)) : 1
+  )> { };
+
+/** @brief Loads a packet from contiguous memory.
+ *
+ *  @tparam N Number of lanes.
+ *  @tparam T Element type.
+ *
+ *  @param t Pointer to the first element.
+ *
+ *  @return Packet holding the elements `t[0]` through `t[N - 1]`.
+ *
+ *  @ingroup CORETYPES
+ */
+template <size_t N, typename T>
+inline constexpr Packet<T, N> packet_load(T const *t) {
+  Packet<T, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = t[k];
+  return p;
+}
+
+/** @brief Creates a packet with the same value in every lane.
+ *
+ *  @tparam N Number of lanes.
+ *  @tparam T Element type.
+ *
+ *  @param t Lane value.
+ *
+ *  @return Packet whose lanes all equal `t`.
+ *
+ *  @ingroup CORETYPES
+ */
+template <size_t N, typename T>
+inline constexpr Packet<T, N> packet_broadcast(T const &t) {
+  Packet<T, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = t;
+  return p;
+}
+
+/** @brief Stores a packet to contiguous memory.
+ *
+ *  @tparam T Packet element type.
+ *  @tparam U Destination element type.
+ *  @tparam N Number of lanes.
+ *
+ *  @param u Pointer to the first destination element.
+ *  @param p Packet.
+ *
+ *  Each lane is assigned to its destination element so any conversion from `T`
+ *  to `U` happens as it would for a scalar assignment.
+ *
+ *  @ingroup CORETYPES
+ */
+template <typename T, typename U, size_t N>
+inline constexpr void packet_store(U *u, Packet<T, N> const &p) {
+  for (size_t k = 0; k < N; k++) u[k] = p[k];
+}
+
+/** @brief Applies an element wise functor lane by lane.
+ *
+ *  @tparam R  Result element type.
+ *  @tparam F  Functor type.
+ *  @tparam N  Number of lanes.
+ *  @tparam Ts Argument packets' element types.
+ *
+ *  @param f  Functor.
+ *  @param ps Argument packets.
+ *
+ *  @return Packet of the functor's results.
+ *
+ *  @ingroup CORETYPES
+ */
+template <typename R, class F, size_t N, typename... Ts>
+inline constexpr Packet<R, N> packet_apply(F const &f, Packet<Ts, N> const &... ps) {
+  Packet<R, N> p = { };
+  for (size_t k = 0; k < N; k++) p[k] = f(ps[k]...);
+  return p;
+}
+
+/** @brief Packet stride of streams whose packets don't depend on storage.
+ *
+ *  Generated streams, for example, produce the same packet regardless of where
+ *  it's located within the tensor. Such streams also report a `void` layout so
+ *  they combine with both row and column major types.
+ *
+ *  @sa internal::packet_stride
+ *
+ *  @ingroup CORETYPES
+ */
+constexpr size_t packet_any_stride = ~size_t(0);
+
+template <class C, typename = void>
+struct _packet : std::false_type {
+  static constexpr size_t stride = 0;
+  typedef RowMajor layout;
+};
+
+template <class L, class M>
+struct _packet_layouts : std::integral_constant<bool, (
+    std::is_void<L>::value || std::is_void<M>::value || std::is_same<L, M>::value
+  )> {
+  typedef std::conditional_t<std::is_void<L>::value, M, L> type;
+};
+
+template <class... Ps>
+struct _packet_join;
+
+template <>
+struct _packet_join<> : std::true_type {
+  static constexpr size_t stride = packet_any_stride;
+  typedef void layout;
+};
+
+template <class P, class... Ps>
+struct _packet_join<P, Ps...> : std::integral_constant<bool, (
+    P::value && _packet_join<Ps...>::value && (
+      (P::stride == packet_any_stride) ||
+      (_packet_join<Ps...>::stride == packet_any_stride) ||
+      (P::stride == _packet_join<Ps...>::stride)
+    ) && _packet_layouts<typename P::layout, typename _packet_join<Ps...>::layout>::value
+  )> {
+  static constexpr size_t stride = (P::stride == packet_any_stride)
+      ? _packet_join<Ps...>::stride : P::stride;
+  typedef typename _packet_layouts<
+      typename P::layout, typename _packet_join<Ps...>::layout
+    >::type layout;
+};
+
+/** @brief Tests if a tensor type supports packet access.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  A tensor type supporting packet access can produce any run of elements that
+ *  are contiguous in its storage as a single packet through
+ *  internal::Stream::packet. Value backed types support packet access as do
+ *  element wise operations whose arguments all support packet access with the
+ *  same internal::packet_stride and layout.
+ *
+ *  Stream assignments use the packet path whenever both the destination and
+ *  the source support it with matching strides and layouts.
+ *
+ *  @sa internal::Packet
+ *  @sa internal::Stream::packet
+ *
+ *  @ingroup CORETYPES
+ */
+template <class C>
+struct has_packet_access : std::integral_constant<bool, _packet<C>::value> { };
+
+/** @brief Leading dimension assumed by a tensor type's packet offsets.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Zero if packets are indexed as if all elements were flattened into an array
+ *  in the order of the type's layout. Otherwise, rows, or columns if column
+ *  major, start every `stride` elements as described by
+ *  internal::traits::stride. Types that don't depend on storage report
+ *  internal::packet_any_stride.
+ *
+ *  @ingroup CORETYPES
+ */
+template <class C>
+struct packet_stride : std::integral_constant<size_t, _packet<C>::stride> { };
+
+/** @brief Tests if a set of tensor types can be combined through packet access.
+ *
+ *  @tparam Cs %Tensor types.
+ *
+ *  True if every type supports packet access and they all index packets with
+ *  the same stride and layout.
+ *
+ *  @sa internal::has_packet_access
+ *  @sa internal::packet_stride
+ *
+ *  @ingroup CORETYPES
+ */
+template <class... Cs>
+struct have_packet_access : std::integral_constant<bool, _packet_join<_packet<Cs>...>::value> { };
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
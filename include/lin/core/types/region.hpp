@@ -0,0 +1,202 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/types/region.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_TYPES_REGION_HPP_
+#define LIN_CORE_TYPES_REGION_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @brief Describes the memory addressed by a tensor.
+ *
+ *  Element `(i, j)` of a tensor covering the region lives at the address
+ *  `origin + i * row_step + j * col_step`. Steps are in bytes.
+ *
+ *  Regions are used by internal::Mapping::operator= to detect whether the
+ *  destination of an assignment overlaps memory the source reads.
+ *
+ *  @sa internal::Stream::aliases
+ *  @sa internal::Mapping::region
+ *
+ *  @ingroup CORETYPES
+ */
+struct Region {
+  /** @brief Address of element `(0, 0)`.
+   */
+  std::uintptr_t origin;
+
+  /** @brief Row count.
+   */
+  size_t rows;
+
+  /** @brief Column count.
+   */
+  size_t cols;
+
+  /** @brief Distance between consecutive rows in bytes.
+   */
+  size_t row_step;
+
+  /** @brief Distance between consecutive columns in bytes.
+   */
+  size_t col_step;
+
+  /** @brief Size of an element in bytes.
+   */
+  size_t elem;
+
+  /** @return Whether the region addresses no memory at all.
+   */
+  inline bool empty() const {
+    return !rows || !cols;
+  }
+
+  /** @return Address one past the last byte of the region's last element.
+   */
+  inline std::uintptr_t last() const {
+    return origin + (rows - 1) * row_step + (cols - 1) * col_step + elem;
+  }
+
+  /** @brief Restricts the region to a block.
+   *
+   *  @param i Row index of the block's first element.
+   *  @param j Column index of the block's first element.
+   *  @param r Row count of the block.
+   *  @param c Column count of the block.
+   *
+   *  @return Region of the block.
+   */
+  inline Region block(size_t i, size_t j, size_t r, size_t c) const {
+    return Region{origin + i * row_step + j * col_step, r, c, row_step, col_step, elem};
+  }
+
+  /** @return Region of the main diagonal as a column vector.
+   */
+  inline Region diagonal() const {
+    return Region{origin, rows, 1, row_step + col_step, col_step, elem};
+  }
+
+  /** @return Region of the transposed tensor.
+   */
+  inline Region transpose() const {
+    return Region{origin, cols, rows, col_step, row_step, elem};
+  }
+
+  /** @brief Tests if two regions address each element in the same place.
+   *
+   *  @param r Other region.
+   *
+   *  Steps along unit dimensions are irrelevant and ignored.
+   */
+  inline bool same_addressing(Region const &r) const {
+    return (origin == r.origin) && (rows == r.rows) && (cols == r.cols) &&
+        ((rows < 2) || (row_step == r.row_step)) &&
+        ((cols < 2) || (col_step == r.col_step));
+  }
+
+  /** @brief Tests if any element of two regions share memory.
+   *
+   *  @param r Other region.
+   *
+   *  If both regions step through memory the same way, which is the case for
+   *  blocks of the same tensor, the test is exact. Otherwise, it conservatively
+   *  compares the address ranges spanned by each region.
+   */
+  inline bool overlaps(Region const &r) const {
+    if (empty() || r.empty()) return false;
+    if ((origin >= r.last()) || (r.origin >= last())) return false;
+    if ((row_step != r.row_step) || (col_step != r.col_step) || (elem != r.elem))
+      return true;
+    return (origin <= r.origin) ? lattice_overlaps(*this, r) : lattice_overlaps(r, *this);
+  }
+
+ private:
+  /* Exact test for two regions with equal steps where b starts at or after a.
+   * Both are treated as rectangles in the element lattice of their common
+   * parent whose leading dimension is the ratio of the steps.
+   */
+  static inline bool lattice_overlaps(Region const &a, Region const &b) {
+    bool const row_major = a.row_step >= a.col_step;
+    size_t const major = row_major ? a.row_step : a.col_step;
+    size_t const minor = row_major ? a.col_step : a.row_step;
+    if (!minor || (major % minor) || ((b.origin - a.origin) % minor)) return true;
+
+    size_t const ld = major / minor;
+    size_t const a_outer = row_major ? a.rows : a.cols, a_inner = row_major ? a.cols : a.rows;
+    size_t const b_inner = row_major ? b.cols : b.rows;
+    if ((a_inner > ld) || (b_inner > ld)) return true;
+
+    size_t const q = (b.origin - a.origin) / minor;
+    size_t const o = q / ld, k = q % ld;
+    // Block b starts at (o, k) or, equivalently, at (o + 1, k - ld)
+    if ((o < a_outer) && (k < a_inner)) return true;
+    if ((o + 1 < a_outer) && (k + b_inner > ld)) return true;
+    return false;
+  }
+};
+
+/** @brief Creates the region of a value backed tensor.
+ *
+ *  @tparam T Element type.
+ *
+ *  @param data      Pointer to element `(0, 0)`.
+ *  @param rows      Row count.
+ *  @param cols      Column count.
+ *  @param stride    Leading dimension in elements.
+ *  @param col_major Whether elements are stored in column major order.
+ *
+ *  @return Region covering the tensor.
+ */
+template <typename T>
+inline Region make_region(T const *data, size_t rows, size_t cols, size_t stride, bool col_major) {
+  return Region{
+      reinterpret_cast<std::uintptr_t>(data), rows, cols,
+      (col_major ? 1 : stride) * sizeof(T), (col_major ? stride : 1) * sizeof(T), sizeof(T)
+    };
+}
+
+/** @brief Tests if reading from one region while writing another is unsafe.
+ *
+ *  @param read       Region read from.
+ *  @param write      Region written to.
+ *  @param positional Whether the element written at `(i, j)` only depends on
+ *                    the element read at `(i, j)`.
+ *
+ *  A positional read from the exact region being written is safe since each
+ *  element is read before it's overwritten.
+ */
+inline bool region_aliases(Region const &read, Region const &write, bool positional) {
+  return read.overlaps(write) && !(positional && read.same_addressing(write));
+}
+
+template <class C>
+using _region_expr = decltype(std::declval<C const &>().region());
+
+/** @brief Tests if a tensor type can describe the memory it addresses.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Value backed types, along with references and transposes of them, provide a
+ *  `region()` member.
+ *
+ *  @sa internal::Region
+ *
+ *  @ingroup CORETYPES
+ */
+template <class C>
+struct has_region : is_detected<_region_expr, C> { };
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -0,0 +1,137 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/types/storage.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_TYPES_STORAGE_HPP_
+#define LIN_CORE_TYPES_STORAGE_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+
+#include <type_traits>
+
+namespace lin {
+
+/** @brief Storage policy for the backing array of a Matrix, RowVector, or
+ *         Vector.
+ *
+ *  @tparam A Alignment of the backing array in bytes. Zero keeps the element
+ *            type's natural alignment.
+ *  @tparam P Whether rows are padded.
+ *  @tparam L Layout tag, either RowMajor or ColMajor.
+ *
+ *  With padding enabled, every row of a matrix or row vector starts on an `A`
+ *  byte boundary. The distance between rows, the leading dimension, is then
+ *  fixed at compile time and is available as internal::traits::stride and
+ *  internal::Base::stride. A column vector's elements remain contiguous but its
+ *  backing array is rounded up to a multiple of `A` bytes.
+ *
+ *  Column major types store one column after another instead and, if padded,
+ *  pad columns rather than rows.
+ *
+ *  The default policy, `Storage<>`, stores elements densely with their natural
+ *  alignment. A policy can be selected per type alias:
+ *
+ *  ~~~{.cpp}
+ *  typedef lin::Matrix<double, 3, 3, 3, 3, lin::PaddedStorage> Matrix3x3da;
+ *  ~~~
+ *
+ *  @sa PaddedStorage
+ *  @sa internal::traits
+ *
+ *  @ingroup CORETYPES
+ */
+template <size_t A = 0, bool P = false, class L = RowMajor>
+struct Storage {
+  static_assert((A & (A - 1)) == 0,
+      "Storage<...> alignment must be zero or a power of two");
+
+  /** @brief Requested alignment in bytes.
+   */
+  static constexpr size_t align = A;
+
+  /** @brief Whether rows are padded.
+   */
+  static constexpr bool pad = P;
+
+  /** @brief Layout tag.
+   */
+  typedef L layout;
+};
+
+/** @brief Storage policy aligning and padding rows to the packet width.
+ *
+ *  Rows of such types are loaded and stored a full packet at a time without
+ *  needing scalar tails.
+ *
+ *  @sa Storage
+ *  @sa LIN_PACKET_BYTES
+ *
+ *  @ingroup CORETYPES
+ */
+typedef Storage<LIN_PACKET_BYTES, true> PaddedStorage;
+
+/** @brief Storage policy storing elements densely in column major order.
+ *
+ *  ~~~{.cpp}
+ *  typedef lin::Matrix<double, 6, 6, 6, 6, lin::ColMajorStorage> Matrix6x6dc;
+ *  ~~~
+ *
+ *  @sa Storage
+ *  @sa ColMajor
+ *
+ *  @ingroup CORETYPES
+ */
+typedef Storage<0, false, ColMajor> ColMajorStorage;
+
+namespace internal {
+
+/** @brief Rounds a count up to a multiple of another.
+ */
+inline constexpr size_t _round_up(size_t n, size_t m) {
+  return ((n + m - 1) / m) * m;
+}
+
+/** @brief Computes the layout of a backing array under a storage policy.
+ *
+ *  @tparam T  Element type.
+ *  @tparam R  Rows at compile time.
+ *  @tparam C  Columns at compile time.
+ *  @tparam MR Maximum rows at compile time.
+ *  @tparam MC Maximum columns at compile time.
+ *  @tparam S  Storage policy.
+ *
+ *  Value backed types specialize internal::_storage by deriving from this.
+ *
+ *  @sa Storage
+ *  @sa internal::_storage
+ */
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class S>
+struct _storage_policy {
+ private:
+  static constexpr bool col_major = std::is_same<typename S::layout, ColMajor>::value;
+
+  /* Dimensions along and across the contiguous runs of elements.
+   */
+  static constexpr size_t inner = col_major ? R : C;
+  static constexpr size_t max_inner = col_major ? MR : MC;
+  static constexpr size_t max_outer = col_major ? MC : MR;
+
+  static constexpr size_t lanes = (S::align / sizeof(T)) ? (S::align / sizeof(T)) : 1;
+  static constexpr size_t padded_inner = _round_up(max_inner, lanes);
+
+ public:
+  static constexpr size_t align = (S::align > alignof(T)) ? S::align : alignof(T);
+  static constexpr size_t stride = (S::pad && (max_inner > 1) &&
+      !((inner == max_inner) && (padded_inner == max_inner))) ? padded_inner : 0;
+  static constexpr size_t size = stride
+      ? max_outer * stride : (S::pad ? _round_up(MR * MC, lanes) : MR * MC);
+  typedef typename S::layout layout;
+};
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -13,6 +13,8 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "packet.hpp"
+#include "region.hpp"
 
 namespace lin {
 namespace internal {
@@ -143,6 +145,50 @@ class Stream {
     return derived()(i);
   }
 
+  /** @brief Provides read only access to a packet of tensor elements.
+   *
+   *  @tparam N Number of lanes.
+   *
+   *  @param i Offset of the first element.
+   *
+   *  @return Packet holding the elements at offsets `i` through `i + N - 1`.
+   *
+   *  Offsets proceed as if all the elements of the tensor stream were flattened
+   *  into an array in the order of the stream's layout with consecutive rows,
+   *  or columns if column major, starting internal::packet_stride elements
+   *  apart.
+   *
+   *  This is only available for tensor types supporting packet access.
+   *
+   *  @sa internal::has_packet_access
+   *  @sa internal::packet_stride
+   */
+  template <size_t N>
+  inline constexpr Packet<typename Traits::elem_t, N> packet(size_t i) const {
+    return derived().template packet<N>(i);
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether element `(i, j)` of this stream is evaluated
+   *                    right before element `(i, j)` of the region is written.
+   *
+   *  @return True if evaluating the stream into the region one element at a
+   *          time may read an element that was already overwritten.
+   *
+   *  Element wise operations pass `positional` through to their arguments while
+   *  operations that move elements around, such as transposes and products,
+   *  clear it.
+   *
+   *  @sa internal::Region
+   *  @sa internal::Mapping::operator=(Stream<C> const &)
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return derived().aliases(r, positional);
+  }
+
   /** @brief Forces evaluation of this stream to a value backed type.
    * 
    *  @returns Resulting value.
@@ -0,0 +1,339 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/core/types/symmetric_matrix.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_CORE_TYPES_SYMMETRIC_MATRIX_HPP_
+#define LIN_CORE_TYPES_SYMMETRIC_MATRIX_HPP_
+
+#include "../config.hpp"
+#include "../traits.hpp"
+#include "dimensions.hpp"
+#include "mapping.hpp"
+#include "matrix.hpp"
+#include "region.hpp"
+#include "tensor.hpp"
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace lin {
+
+/** @brief Symmetric matrix storing only its lower triangle.
+ *
+ *  @tparam T  %Matrix element type.
+ *  @tparam N  Rows and columns at compile time.
+ *  @tparam MN Maximum rows and columns at compile time.
+ *
+ *  The lower triangle, diagonal included, is packed row after row into a
+ *  member array of \f$MN(MN+1)/2\f$ elements. Element `(i, j)` above the
+ *  diagonal reads and writes element `(j, i)` so the matrix can be used
+ *  anywhere a square matrix is read.
+ *
+ *  lin::chol leaves the Cholesky factor in the lower triangle, but entries
+ *  above the diagonal still read the mirrored `(j, i)` rather than zero. The
+ *  factor must only be read through its lower triangle, e.g. with
+ *  lin::forward_sub; using it as a full matrix, as in `L * transpose(L)` or
+ *  `fro(L)`, gives wrong results.
+ *
+ *  Assignments only evaluate and write the lower triangle, which halves the
+ *  work of forming covariance like matrices such as `A * P * transpose(A)`.
+ *  The stream being assigned is assumed to be symmetric; its upper triangle is
+ *  never read. lin::chol factorizes the packed triangle in place and lin::fro
+ *  and lin::sum reduce it directly.
+ *
+ *  Writes through references to a block straddling the diagonal land on both
+ *  mirrored elements so such blocks should only be assigned symmetric values.
+ *
+ *  ~~~{.cpp}
+ *  lin::SymmetricMatrixd<18> P = lin::identity<lin::Matrixd<18, 18>>();
+ *  P = F * P * lin::transpose(F) + Q;
+ *  ~~~
+ *
+ *  @sa internal::is_symmetric
+ *
+ *  @ingroup CORETYPES
+ */
+template <typename T, size_t N, size_t MN = N>
+class SymmetricMatrix : public internal::Mapping<SymmetricMatrix<T, N, MN>>,
+    public internal::Dimensions<SymmetricMatrix<T, N, MN>> {
+  static_assert(internal::conjunction<
+      internal::is_matrix<SymmetricMatrix<T, N, MN>>,
+      internal::has_valid_traits<SymmetricMatrix<T, N, MN>>
+    >::value, "Invalid SymmetricMatrix<...> parameters");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef internal::traits<SymmetricMatrix<T, N, MN>> Traits;
+
+ private:
+  typedef internal::Mapping<SymmetricMatrix<T, N, MN>> Map;
+  typedef internal::Dimensions<SymmetricMatrix<T, N, MN>> Dims;
+
+  /* Packed lower triangle. It's zero initialized unless constructed with the
+   * uninitialized tag.
+   */
+  struct Array {
+    T v[MN * (MN + 1) / 2];
+
+    constexpr Array() : v{} { }
+    explicit Array(uninitialized_t) { }
+  } elems;
+
+  /* Fixed size matrices are zero initialized before being assigned a stream
+   * so they remain usable in constant expressions.
+   */
+  constexpr SymmetricMatrix(std::true_type, size_t r, size_t c) {
+    resize(r, c);
+  }
+
+  constexpr SymmetricMatrix(std::false_type, size_t r, size_t c)
+  : SymmetricMatrix(uninitialized, r, c) { }
+
+ protected:
+  using Map::derived;
+
+ public:
+  using Map::size;
+  using Map::eval;
+  using Map::operator=;
+  using Dims::rows;
+  using Dims::cols;
+
+  constexpr SymmetricMatrix(SymmetricMatrix<T, N, MN> const &) = default;
+  constexpr SymmetricMatrix(SymmetricMatrix<T, N, MN> &&) = default;
+  constexpr SymmetricMatrix<T, N, MN> &operator=(SymmetricMatrix<T, N, MN> const &) = default;
+  constexpr SymmetricMatrix<T, N, MN> &operator=(SymmetricMatrix<T, N, MN> &&) = default;
+
+  /** @brief Constructs a new symmetric matrix with zero initialized elements
+   *         and the largest allowable dimensions.
+   */
+  constexpr SymmetricMatrix() {
+    resize(MN, MN);
+  }
+
+  /** @brief Constructs a symmetric matrix with zero initialized elements and
+   *         the requested dimensions.
+   *
+   *  @param r Initial row dimension.
+   *  @param c Initial column dimension.
+   */
+  constexpr SymmetricMatrix(size_t r, size_t c) {
+    resize(r, c);
+  }
+
+  /** @brief Constructs a symmetric matrix with uninitialized elements and the
+   *         requested dimensions.
+   *
+   *  @param r Initial row dimension.
+   *  @param c Initial column dimension.
+   *
+   *  @sa lin::uninitialized
+   */
+  constexpr SymmetricMatrix(uninitialized_t, size_t r, size_t c) : elems(uninitialized) {
+    resize(r, c);
+  }
+
+  /** @brief Constructs a symmetric matrix with elements initialized from an
+   *         initializer list.
+   *
+   *  @tparam U   Element type of the initializer list.
+   *  @param list Initializer list.
+   *
+   *  Elements are listed in row major order, as with any other matrix, and
+   *  must be symmetric.
+   *
+   *  @sa internal::Mapping::operator=(std::initializer_list<T> const &)
+   */
+  template <typename U>
+  constexpr SymmetricMatrix(std::initializer_list<U> const &list) {
+    resize(MN, MN);
+    derived() = list;
+  }
+
+  /** @brief Constructs a symmetric matrix from the lower triangle of another
+   *         tensor stream.
+   *
+   *  @tparam C Other derived type.
+   *  @param  s Other tensor stream.
+   *
+   *  Only the lower triangle of the stream is evaluated.
+   *
+   *  @sa internal::Mapping::operator=(Stream<C> const &)
+   */
+  template <class C>
+  constexpr SymmetricMatrix(internal::Stream<C> const &s)
+  : SymmetricMatrix(internal::has_fixed_dimensions<SymmetricMatrix<T, N, MN>>(), s.rows(), s.cols()) {
+    internal::MappingNoAlias<SymmetricMatrix<T, N, MN>>{derived()} = s;
+  }
+
+  /** @brief Resizes the matrix.
+   *
+   *  @param r Number of rows.
+   *  @param c Number of columns.
+   *
+   *  The matrix must remain square. Elements are packed by row so the
+   *  elements of the leading rows and columns are preserved.
+   */
+  constexpr void resize(size_t r, size_t c) {
+    LIN_ASSERT(r == c /* SymmetricMatrix<...> must be square */);
+
+    Dims::resize(r, c);
+  }
+
+  /** @brief Provides read and write access to matrix elements.
+   *
+   *  @param i Row index.
+   *  @param j Column index.
+   *
+   *  @return Reference to the element shared by `(i, j)` and `(j, i)`.
+   */
+  constexpr T &operator()(size_t i, size_t j) {
+    LIN_ASSERT(i < rows());
+    LIN_ASSERT(j < cols());
+
+    return elems.v[(i < j) ? j * (j + 1) / 2 + i : i * (i + 1) / 2 + j];
+  }
+
+  /** @brief Provides read only access to matrix elements.
+   *
+   *  @param i Row index.
+   *  @param j Column index.
+   *
+   *  @return Value of the element shared by `(i, j)` and `(j, i)`.
+   */
+  constexpr T operator()(size_t i, size_t j) const {
+    return const_cast<SymmetricMatrix<T, N, MN> &>(*this)(i, j);
+  }
+
+  /** @brief Provides read and write access to matrix elements.
+   *
+   *  @param i Index.
+   *
+   *  @return Reference to the matrix element.
+   *
+   *  Element access proceeds as if all the elements of the matrix were
+   *  flattened into an array in row major order.
+   */
+  constexpr T &operator()(size_t i) {
+    LIN_ASSERT(i < size());
+
+    return (*this)(i / cols(), i % cols());
+  }
+
+  /** @brief Provides read only access to matrix elements.
+   *
+   *  @param i Index.
+   *
+   *  @return Value of the matrix element.
+   *
+   *  Element access proceeds as if all the elements of the matrix were
+   *  flattened into an array in row major order.
+   */
+  constexpr T operator()(size_t i) const {
+    return const_cast<SymmetricMatrix<T, N, MN> &>(*this)(i);
+  }
+
+  /** @brief Retrieves a pointer to the packed lower triangle.
+   *
+   *  @return Pointer to element `(0, 0)`.
+   *
+   *  Row `i` of the lower triangle starts \f$i(i+1)/2\f$ elements in and holds
+   *  elements `(i, 0)` through `(i, i)` contiguously.
+   */
+  constexpr T *packed() {
+    return elems.v;
+  }
+
+  /** @brief Retrieves a constant pointer to the packed lower triangle.
+   *
+   *  @return Constant pointer to element `(0, 0)`.
+   *
+   *  @sa SymmetricMatrix::packed
+   */
+  constexpr T const *packed() const {
+    return elems.v;
+  }
+
+  /** @return Number of elements in the packed lower triangle.
+   */
+  constexpr size_t packed_size() const {
+    return rows() * (rows() + 1) / 2;
+  }
+
+  /** @return Region of memory holding the matrix's elements.
+   *
+   *  Every element is conservatively reported as covering the entire packed
+   *  triangle. Only an assignment reading the matrix itself element for
+   *  element is considered safe.
+   *
+   *  @sa internal::Region
+   */
+  inline internal::Region region() const {
+    return internal::Region{reinterpret_cast<std::uintptr_t>(elems.v), rows(), cols(),
+        0, 0, packed_size() * sizeof(T)};
+  }
+};
+
+/** @weakgroup CORETYPES
+ *  @{
+ */
+
+/** @brief Generic float symmetric matrix.
+ *
+ *  @tparam N  Rows and columns at compile time.
+ *  @tparam MN Maximum rows and columns.
+ *
+ *  @sa SymmetricMatrix
+ */
+template <size_t N, size_t MN = N>
+using SymmetricMatrixf = SymmetricMatrix<float, N, MN>;
+
+typedef SymmetricMatrixf<2> SymmetricMatrix2x2f; ///< Two by two float symmetric matrix.
+typedef SymmetricMatrixf<3> SymmetricMatrix3x3f; ///< Three by three float symmetric matrix.
+typedef SymmetricMatrixf<4> SymmetricMatrix4x4f; ///< Four by four float symmetric matrix.
+
+/** @brief Generic double symmetric matrix.
+ *
+ *  @tparam N  Rows and columns at compile time.
+ *  @tparam MN Maximum rows and columns.
+ *
+ *  @sa SymmetricMatrix
+ */
+template <size_t N, size_t MN = N>
+using SymmetricMatrixd = SymmetricMatrix<double, N, MN>;
+
+typedef SymmetricMatrixd<2> SymmetricMatrix2x2d; ///< Two by two double symmetric matrix.
+typedef SymmetricMatrixd<3> SymmetricMatrix3x3d; ///< Three by three double symmetric matrix.
+typedef SymmetricMatrixd<4> SymmetricMatrix4x4d; ///< Four by four double symmetric matrix.
+
+/** @}
+ */
+
+namespace internal {
+
+template <typename T, size_t N, size_t MN>
+struct _elem<SymmetricMatrix<T, N, MN>> {
+  typedef T type;
+};
+
+template <typename T, size_t N, size_t MN>
+struct _dims<SymmetricMatrix<T, N, MN>> {
+  static constexpr size_t rows = N;
+  static constexpr size_t cols = N;
+  static constexpr size_t max_rows = MN;
+  static constexpr size_t max_cols = MN;
+};
+
+template <typename T, size_t N, size_t MN>
+struct _symmetric<SymmetricMatrix<T, N, MN>> : std::true_type { };
+
+}  // namespace internal
+}  // namespace lin
+
+#endif
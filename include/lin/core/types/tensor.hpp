@@ -11,9 +11,38 @@
 #include "../traits.hpp"
 #include "base.hpp"
 
+#include <algorithm>
 #include <initializer_list>
+#include <type_traits>
 
 namespace lin {
+
+/** @brief Tag type selecting constructors that leave elements uninitialized.
+ *
+ *  @sa uninitialized
+ *
+ *  @ingroup CORETYPES
+ */
+struct uninitialized_t {
+  explicit constexpr uninitialized_t() = default;
+};
+
+/** @brief Tag requesting a tensor be constructed without zero initializing
+ *         its elements.
+ *
+ *  Meant for temporaries whose elements are all written before being read.
+ *
+ *  ~~~{.cpp}
+ *  lin::Matrixd<0, 0, 32, 32> A(lin::uninitialized, 8, 8);
+ *  A = lin::transpose(B);
+ *  ~~~
+ *
+ *  @sa internal::Tensor::Tensor(uninitialized_t, size_t, size_t)
+ *
+ *  @ingroup CORETYPES
+ */
+constexpr uninitialized_t uninitialized{};
+
 namespace internal {
 
 /** @brief Member array backed tensor.
@@ -21,11 +50,15 @@ namespace internal {
  *  @tparam D Derived type.
  * 
  *  This is the most commonly used implementation of the internal::Base interface.
- *  %Tensor elements are stored contiguously in a member backing array in row
- *  major order.
+ *  %Tensor elements are stored contiguously in a member backing array in the
+ *  order given by internal::traits::layout.
  * 
  *  This type is directly derived by the user facing Matrix, RowVector, and Vector
  *  types.
+ *
+ *  Copies and moves of tensors with bounded dimensions only touch the elements
+ *  the tensor currently holds rather than the entire backing array. Elements
+ *  outside of those are left unspecified.
  * 
  *  @sa internal::Base
  *  @sa Matrix
@@ -47,7 +80,54 @@ class Tensor : public Base<D> {
   typedef traits<D> Traits;
 
  private:
-  typename Traits::elem_t elems[Traits::max_size] = { typename Traits::elem_t(0) };
+  /* Backing array. It's zero initialized unless constructed with the
+   * uninitialized tag.
+   */
+  struct Array {
+    alignas(_storage<D>::align)
+    typename Traits::elem_t v[_storage<D>::size];
+
+    constexpr Array() : v{} { }
+    explicit Array(uninitialized_t) { }
+  } elems;
+
+  /* Number of leading backing array elements spanned by the current
+   * dimensions, padding included.
+   */
+  constexpr size_t extent() const {
+    return Traits::stride
+        ? (is_col_major<D>::value ? cols() : rows()) * Traits::stride : size();
+  }
+
+  /* Fixed size tensors always hold every element so the entire backing array
+   * is copied at once. Otherwise, only the elements currently held are.
+   */
+  constexpr Tensor(Tensor<D> const &t, std::true_type)
+  : Base<D>(t), elems(t.elems) { }
+
+  Tensor(Tensor<D> const &t, std::false_type)
+  : Base<D>(t), elems(uninitialized) {
+    std::copy_n(t.elems.v, extent(), elems.v);
+  }
+
+  constexpr void copy(Tensor<D> const &t, std::true_type) {
+    elems = t.elems;
+  }
+
+  void copy(Tensor<D> const &t, std::false_type) {
+    Base<D>::resize(t.rows(), t.cols());
+    std::copy_n(t.elems.v, extent(), elems.v);
+  }
+
+  /* Fixed size tensors are zero initialized before being assigned a stream so
+   * they remain usable in constant expressions.
+   */
+  constexpr Tensor(std::true_type, size_t r, size_t c) {
+    resize(r, c);
+  }
+
+  constexpr Tensor(std::false_type, size_t r, size_t c)
+  : Tensor(uninitialized, r, c) { }
 
  protected:
   using Base<D>::derived;
@@ -60,12 +140,47 @@ class Tensor : public Base<D> {
   using Base<D>::operator=;
   using Base<D>::operator();
   using Base<D>::data;
+  using Base<D>::stride;
   using Base<D>::eval;
 
-  constexpr Tensor(Tensor<D> const &) = default;
-  constexpr Tensor(Tensor<D> &&) = default;
-  constexpr Tensor<D> &operator=(Tensor<D> const &) = default;
-  constexpr Tensor<D> &operator=(Tensor<D> &&) = default;
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   */
+  constexpr Tensor(Tensor<D> const &t)
+  : Tensor(t, has_fixed_dimensions<D>()) { }
+
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   *
+   *  Elements are held by value so this is the same as a copy.
+   */
+  constexpr Tensor(Tensor<D> &&t)
+  : Tensor(static_cast<Tensor<D> const &>(t), has_fixed_dimensions<D>()) { }
+
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   *
+   *  @return Reference to this tensor.
+   */
+  constexpr Tensor<D> &operator=(Tensor<D> const &t) {
+    if (this != &t) copy(t, has_fixed_dimensions<D>());
+    return *this;
+  }
+
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   *
+   *  @return Reference to this tensor.
+   *
+   *  Elements are held by value so this is the same as a copy.
+   */
+  constexpr Tensor<D> &operator=(Tensor<D> &&t) {
+    return *this = static_cast<Tensor<D> const &>(t);
+  }
 
   /** @brief Constructs a new tensor with zeros initialized elements and the
    *         largest allowable dimensions.
@@ -88,6 +203,30 @@ class Tensor : public Base<D> {
     resize(r, c);
   }
 
+  /** @brief Constructs a tensor with uninitialized elements and the largest
+   *         allowable dimensions.
+   *
+   *  @sa lin::uninitialized
+   */
+  explicit constexpr Tensor(uninitialized_t)
+  : Tensor(uninitialized, Traits::max_rows, Traits::max_cols) { }
+
+  /** @brief Constructs a tensor with uninitialized elements and the requested
+   *         dimensions.
+   *
+   *  @param r Initial row dimension.
+   *  @param c Initial column dimesnion.
+   *
+   *  Skips zero initializing the backing array. Every element must be written
+   *  before it's read.
+   *
+   *  @sa lin::uninitialized
+   *  @sa internal::traits
+   */
+  constexpr Tensor(uninitialized_t, size_t r, size_t c) : elems(uninitialized) {
+    resize(r, c);
+  }
+
   /** @brief Constructs a tensor with elements initialized from an initializer
    *         list.
    * 
@@ -135,25 +274,31 @@ class Tensor : public Base<D> {
    *  The tensor will automatically attempt to resize to the dimensions of the
    *  other tensor stream.
    * 
-   *  The stream must be assignable to a tensor of this type.
+   *  The stream must be assignable to a tensor of this type. A tensor under
+   *  construction can't alias the stream so no aliasing check is made.
+   *
+   *  Every element is immediately overwritten so, unless the tensor has fixed
+   *  dimensions and may be used in a constant expression, the backing array
+   *  isn't zero initialized first. This is how temporaries are evaluated.
    * 
    *  @sa internal::Mapping::operator=(Stream<C> const &)
    */
   template <class C>
-  constexpr Tensor(Stream<C> const &s) {
-    resize(s.rows(), s.cols());
-    derived() = s;
+  constexpr Tensor(Stream<C> const &s)
+  : Tensor(has_fixed_dimensions<D>(), s.rows(), s.cols()) {
+    MappingNoAlias<D>{derived()} = s;
   }
 
   /** @brief Retrives a pointer to the element backing array.
    * 
    *  @returns Pointer to the backing array.
    * 
-   *  The elements of the tensor are layed out in row major order in the backing
-   *  array. They are stored continguously in memory.
+   *  The elements of the tensor are layed out in the order given by
+   *  internal::traits::layout in the backing array. Consecutive rows, or
+   *  columns if column major, start internal::Base::stride elements apart.
    */
   constexpr typename Traits::elem_t *data() {
-    return elems;
+    return elems.v;
   }
 };
 }  // namespace internal
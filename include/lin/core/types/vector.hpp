@@ -9,6 +9,7 @@
 
 #include "../config.hpp"
 #include "../traits.hpp"
+#include "storage.hpp"
 #include "tensor.hpp"
 
 #include <type_traits>
@@ -20,6 +21,7 @@ namespace lin {
  *  @tparam T  %Vector element type.
  *  @tparam N  Number of elements at compile time (i.e. number of rows).
  *  @tparam MN Maximum number of elements (i.e. maximum number of rows).
+ *  @tparam S  Storage policy.
  * 
  *  The template parameters specify the vector's traits. The traits must qualify
  *  this type as a column vector.
@@ -29,9 +31,9 @@ namespace lin {
  * 
  *  @ingroup CORETYPES
  */
-template <typename T, size_t N, size_t MN = N>
-class Vector : public internal::Tensor<Vector<T, N, MN>> {
-  static_assert(internal::is_col_vector<Vector<T, N, MN>>::value,
+template <typename T, size_t N, size_t MN = N, class S = Storage<>>
+class Vector : public internal::Tensor<Vector<T, N, MN, S>> {
+  static_assert(internal::is_col_vector<Vector<T, N, MN, S>>::value,
       "Invalid Vector<...> parameters");
 
  public:
@@ -39,33 +41,34 @@ class Vector : public internal::Tensor<Vector<T, N, MN>> {
    * 
    *  @sa internal::traits
    */
-  typedef internal::traits<Vector<T, N, MN>> Traits;
+  typedef internal::traits<Vector<T, N, MN, S>> Traits;
 
   /** @brief Vector traits information for this type.
    * 
    *  @sa internal::vector_traits
    */
-  typedef internal::vector_traits<Vector<T, N, MN>> VectorTraits;
+  typedef internal::vector_traits<Vector<T, N, MN, S>> VectorTraits;
 
  protected:
-  using internal::Tensor<Vector<T, N, MN>>::derived;
+  using internal::Tensor<Vector<T, N, MN, S>>::derived;
 
  public:
-  using internal::Tensor<Vector<T, N, MN>>::Tensor;
-  using internal::Tensor<Vector<T, N, MN>>::rows;
-  using internal::Tensor<Vector<T, N, MN>>::cols;
-  using internal::Tensor<Vector<T, N, MN>>::size;
-  using internal::Tensor<Vector<T, N, MN>>::data;
-  using internal::Tensor<Vector<T, N, MN>>::eval;
-  using internal::Tensor<Vector<T, N, MN>>::resize;
-  using internal::Tensor<Vector<T, N, MN>>::operator=;
-  using internal::Tensor<Vector<T, N, MN>>::operator();
+  using internal::Tensor<Vector<T, N, MN, S>>::Tensor;
+  using internal::Tensor<Vector<T, N, MN, S>>::rows;
+  using internal::Tensor<Vector<T, N, MN, S>>::cols;
+  using internal::Tensor<Vector<T, N, MN, S>>::size;
+  using internal::Tensor<Vector<T, N, MN, S>>::data;
+  using internal::Tensor<Vector<T, N, MN, S>>::stride;
+  using internal::Tensor<Vector<T, N, MN, S>>::eval;
+  using internal::Tensor<Vector<T, N, MN, S>>::resize;
+  using internal::Tensor<Vector<T, N, MN, S>>::operator=;
+  using internal::Tensor<Vector<T, N, MN, S>>::operator();
 
   constexpr Vector() = default;
-  constexpr Vector(Vector<T, N, MN> const &) = default;
-  constexpr Vector(Vector<T, N, MN> &&) = default;
-  constexpr Vector<T, N, MN> &operator=(Vector<T, N, MN> const &) = default;
-  constexpr Vector<T, N, MN> &operator=(Vector<T, N, MN> &&) = default;
+  constexpr Vector(Vector<T, N, MN, S> const &) = default;
+  constexpr Vector(Vector<T, N, MN, S> &&) = default;
+  constexpr Vector<T, N, MN, S> &operator=(Vector<T, N, MN, S> const &) = default;
+  constexpr Vector<T, N, MN, S> &operator=(Vector<T, N, MN, S> &&) = default;
 
   /** @brief Constructs a vector with zero initialized elements are the requested
    *         length.
@@ -79,7 +82,17 @@ class Vector : public internal::Tensor<Vector<T, N, MN>> {
    *  @sa internal::has_strictly_bounded_rows
    */
   constexpr Vector(size_t n)
-  : internal::Tensor<Vector<T, N, MN>>(n, 1) { }
+  : internal::Tensor<Vector<T, N, MN, S>>(n, 1) { }
+
+  /** @brief Constructs a vector with uninitialized elements and the requested
+   *         length.
+   *
+   *  @param n Initial length.
+   *
+   *  @sa lin::uninitialized
+   */
+  constexpr Vector(uninitialized_t, size_t n)
+  : internal::Tensor<Vector<T, N, MN, S>>(uninitialized, n, 1) { }
 
   /** @brief Constructs a vector with elements initialized from an initializer
    *         list and the requested length.
@@ -96,7 +109,7 @@ class Vector : public internal::Tensor<Vector<T, N, MN>> {
    */
   template <typename U>
   constexpr Vector(size_t n, std::initializer_list<U> const &list)
-  : internal::Tensor<Vector<T, N, MN>>(n, 1, list) { }
+  : internal::Tensor<Vector<T, N, MN, S>>(n, 1, list) { }
 
   /** @brief Resizes the vector's length.
    *  
@@ -118,6 +131,7 @@ class Vector : public internal::Tensor<Vector<T, N, MN>> {
  *  @tparam T  Row vector element type.
  *  @tparam N  Number of elements at compile time (i.e. number of rows).
  *  @tparam MN Maximum number of elements (i.e. maximum number of rows).
+ *  @tparam S  Storage policy.
  * 
  *  The template parameters specify the row vector's traits. The traits must
  *  qualify this type as a row vector.
@@ -127,9 +141,9 @@ class Vector : public internal::Tensor<Vector<T, N, MN>> {
  * 
  *  @ingroup CORETYPES
  */
-template <typename T, size_t N, size_t MN = N>
-class RowVector : public internal::Tensor<RowVector<T, N, MN>> {
-  static_assert(internal::is_row_vector<RowVector<T, N, MN>>::value,
+template <typename T, size_t N, size_t MN = N, class S = Storage<>>
+class RowVector : public internal::Tensor<RowVector<T, N, MN, S>> {
+  static_assert(internal::is_row_vector<RowVector<T, N, MN, S>>::value,
       "Invalid RowVector<...> parameters");
 
  public:
@@ -137,33 +151,34 @@ class RowVector : public internal::Tensor<RowVector<T, N, MN>> {
    * 
    *  @sa internal::traits
    */
-  typedef internal::traits<RowVector<T, N, MN>> Traits;
+  typedef internal::traits<RowVector<T, N, MN, S>> Traits;
 
   /** @brief Vector traits information for this type.
    * 
    *  @sa internal::vector_traits
    */
-  typedef internal::vector_traits<RowVector<T, N, MN>> VectorTraits;
+  typedef internal::vector_traits<RowVector<T, N, MN, S>> VectorTraits;
 
  protected:
-  using internal::Tensor<RowVector<T, N, MN>>::derived;
+  using internal::Tensor<RowVector<T, N, MN, S>>::derived;
 
  public:
-  using internal::Tensor<RowVector<T, N, MN>>::Tensor;
-  using internal::Tensor<RowVector<T, N, MN>>::rows;
-  using internal::Tensor<RowVector<T, N, MN>>::cols;
-  using internal::Tensor<RowVector<T, N, MN>>::size;
-  using internal::Tensor<RowVector<T, N, MN>>::data;
-  using internal::Tensor<RowVector<T, N, MN>>::eval;
-  using internal::Tensor<RowVector<T, N, MN>>::resize;
-  using internal::Tensor<RowVector<T, N, MN>>::operator=;
-  using internal::Tensor<RowVector<T, N, MN>>::operator();
+  using internal::Tensor<RowVector<T, N, MN, S>>::Tensor;
+  using internal::Tensor<RowVector<T, N, MN, S>>::rows;
+  using internal::Tensor<RowVector<T, N, MN, S>>::cols;
+  using internal::Tensor<RowVector<T, N, MN, S>>::size;
+  using internal::Tensor<RowVector<T, N, MN, S>>::data;
+  using internal::Tensor<RowVector<T, N, MN, S>>::stride;
+  using internal::Tensor<RowVector<T, N, MN, S>>::eval;
+  using internal::Tensor<RowVector<T, N, MN, S>>::resize;
+  using internal::Tensor<RowVector<T, N, MN, S>>::operator=;
+  using internal::Tensor<RowVector<T, N, MN, S>>::operator();
 
   constexpr RowVector() = default;
-  constexpr RowVector(RowVector<T, N, MN> const &) = default;
-  constexpr RowVector(RowVector<T, N, MN> &&) = default;
-  constexpr RowVector<T, N, MN> &operator=(RowVector<T, N, MN> const &) = default;
-  constexpr RowVector<T, N, MN> &operator=(RowVector<T, N, MN> &&) = default;
+  constexpr RowVector(RowVector<T, N, MN, S> const &) = default;
+  constexpr RowVector(RowVector<T, N, MN, S> &&) = default;
+  constexpr RowVector<T, N, MN, S> &operator=(RowVector<T, N, MN, S> const &) = default;
+  constexpr RowVector<T, N, MN, S> &operator=(RowVector<T, N, MN, S> &&) = default;
 
   /** @brief Constructs a row vector with zero initialized elements are the
    *         requested length.
@@ -177,7 +192,17 @@ class RowVector : public internal::Tensor<RowVector<T, N, MN>> {
    *  @sa internal::has_strictly_bounded_rows
    */
   constexpr RowVector(size_t n)
-  : internal::Tensor<RowVector<T, N, MN>>(1, n) { }
+  : internal::Tensor<RowVector<T, N, MN, S>>(1, n) { }
+
+  /** @brief Constructs a row vector with uninitialized elements and the
+   *         requested length.
+   *
+   *  @param n Initial length.
+   *
+   *  @sa lin::uninitialized
+   */
+  constexpr RowVector(uninitialized_t, size_t n)
+  : internal::Tensor<RowVector<T, N, MN, S>>(uninitialized, 1, n) { }
 
   /** @brief Constructs a row vector with elements initialized from an initializer
    *         list and the requested length.
@@ -194,7 +219,7 @@ class RowVector : public internal::Tensor<RowVector<T, N, MN>> {
    */
   template <typename U>
   constexpr RowVector(size_t n, std::initializer_list<U> const &list)
-  : internal::Tensor<RowVector<T, N, MN>>(1, n, list) { }
+  : internal::Tensor<RowVector<T, N, MN, S>>(1, n, list) { }
 
   /** @brief Resizes the row vector's length.
    *  
@@ -219,12 +244,13 @@ class RowVector : public internal::Tensor<RowVector<T, N, MN>> {
  * 
  *  @tparam N  Length at compile time
  *  @tparam MN Max length.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa Vector
  */
-template <size_t N, size_t MN = N>
-using Vectorf = Vector<float, N, MN>;
+template <size_t N, size_t MN = N, class S = Storage<>>
+using Vectorf = Vector<float, N, MN, S>;
 
 typedef Vectorf<2> Vector2f; ///< Two dimensional float vector.
 typedef Vectorf<3> Vector3f; ///< Three dimensional float vector.
@@ -234,12 +260,13 @@ typedef Vectorf<4> Vector4f; ///< Four dimensional float vector.
  * 
  *  @tparam N  Length at compile time
  *  @tparam MN Max length.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa Vector
  */
-template <size_t N, size_t MN = N>
-using Vectord = Vector<double, N, MN>;
+template <size_t N, size_t MN = N, class S = Storage<>>
+using Vectord = Vector<double, N, MN, S>;
 
 typedef Vectord<2> Vector2d; ///< Two dimensional double vector.
 typedef Vectord<3> Vector3d; ///< Three dimensional double vector.
@@ -249,12 +276,13 @@ typedef Vectord<4> Vector4d; ///< Four dimensional double vector.
  * 
  *  @tparam N  Length at compile time
  *  @tparam MN Max length.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa RowVector
  */
-template <size_t N, size_t MN = N>
-using RowVectorf = RowVector<float, N, MN>;
+template <size_t N, size_t MN = N, class S = Storage<>>
+using RowVectorf = RowVector<float, N, MN, S>;
 
 typedef RowVectorf<2> RowVector2f; ///< Two dimensional float row vector.
 typedef RowVectorf<3> RowVector3f; ///< Three dimensional float row vector.
@@ -264,12 +292,13 @@ typedef RowVectorf<4> RowVector4f; ///< Four dimensional float row vector.
  * 
  *  @tparam N  Length at compile time
  *  @tparam MN Max length.
+ *  @tparam S  Storage policy.
  * 
  *  @sa internal::traits
  *  @sa RowVector
  */
-template <size_t N, size_t MN = N>
-using RowVectord = RowVector<double, N, MN>;
+template <size_t N, size_t MN = N, class S = Storage<>>
+using RowVectord = RowVector<double, N, MN, S>;
 
 typedef RowVectord<2> RowVector2d; ///< Two dimensional double row vector.
 typedef RowVectord<3> RowVector3d; ///< Three dimensional double row vector.
@@ -280,21 +309,25 @@ typedef RowVectord<4> RowVector4d; ///< Four dimensional double row vector.
 
 namespace internal {
 
-template <typename T, size_t N, size_t MN>
-struct _elem<Vector<T, N, MN>> {
+template <typename T, size_t N, size_t MN, class S>
+struct _elem<Vector<T, N, MN, S>> {
   typedef T type;
 };
 
-template <typename T, size_t N, size_t MN>
-struct _dims<Vector<T, N, MN>> {
+template <typename T, size_t N, size_t MN, class S>
+struct _dims<Vector<T, N, MN, S>> {
   static constexpr size_t rows = N;
   static constexpr size_t cols = 1;
   static constexpr size_t max_rows = MN;
   static constexpr size_t max_cols = 1;
 };
 
+template <typename T, size_t N, size_t MN, class S>
+struct _storage<Vector<T, N, MN, S>> : _storage_policy<T, N, 1, MN, 1, S> { };
+
 template <class C>
-struct _eval<C, std::enable_if_t<is_col_vector<C>::value>> {
+struct _eval<C, std::enable_if_t<conjunction<
+    is_col_vector<C>, negation<has_dynamic_dimensions<C>>>::value>> {
   typedef Vector<
       _elem_t<C>,
       _dims<C>::rows,
@@ -302,21 +335,25 @@ struct _eval<C, std::enable_if_t<is_col_vector<C>::value>> {
     > type;
 };
 
-template <typename T, size_t N, size_t MN>
-struct _elem<RowVector<T, N, MN>> {
+template <typename T, size_t N, size_t MN, class S>
+struct _elem<RowVector<T, N, MN, S>> {
   typedef T type;
 };
 
-template <typename T, size_t N, size_t MN>
-struct _dims<RowVector<T, N, MN>> {
+template <typename T, size_t N, size_t MN, class S>
+struct _dims<RowVector<T, N, MN, S>> {
   static constexpr size_t rows = 1;
   static constexpr size_t cols = N;
   static constexpr size_t max_rows = 1;
   static constexpr size_t max_cols = MN;
 };
 
+template <typename T, size_t N, size_t MN, class S>
+struct _storage<RowVector<T, N, MN, S>> : _storage_policy<T, 1, N, 1, MN, S> { };
+
 template <class C>
-struct _eval<C, std::enable_if_t<is_row_vector<C>::value>> {
+struct _eval<C, std::enable_if_t<conjunction<
+    is_row_vector<C>, negation<has_dynamic_dimensions<C>>>::value>> {
   typedef RowVector<
       _elem_t<C>,
       _dims<C>::cols,
@@ -0,0 +1,71 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+//
+// MIT License
+//
+// Copyright (c) 2020 kylekrol
+// Copyright (c) 2020 Pathfinder for Autonomous Navigation (PAN)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/** @file lin/dynamic.hpp
+ *  @author Kyle Krol
+ */
+
+/** @defgroup DYNAMIC Dynamic
+ *
+ *  @brief Runtime sized tensor types backed by caller supplied memory.
+ *
+ *  Every other value backed type in lin stores its largest possible size
+ *  inline. That's ideal for small, bounded problems but impractical once
+ *  dimensions reach the hundreds or thousands. The dynamic module adds
+ *  lin::DynamicMatrix, lin::DynamicRowVector, and lin::DynamicVector whose
+ *  elements are allocated from an lin::Arena over a buffer supplied by the
+ *  caller. No memory is ever allocated from the heap.
+ *
+ *  Runtime sized types work with every stream operation. Temporaries created
+ *  while evaluating expressions of them are allocated from the current
+ *  thread's default arena which is set with lin::ArenaScope:
+ *
+ *  ~~~{.cpp}
+ *  #include <lin/core.hpp>
+ *  #include <lin/dynamic.hpp>
+ *
+ *  double residual(lin::Arena &arena, std::size_t n) {
+ *    lin::ArenaScope scope(arena);
+ *
+ *    lin::DynamicMatrixd A(arena, n, n);
+ *    lin::DynamicVectord x(arena, n), b(arena, n);
+ *    // ...
+ *    return lin::norm(A * x - b);
+ *  }
+ *  ~~~
+ */
+
+#ifndef LIN_DYNAMIC_HPP_
+#define LIN_DYNAMIC_HPP_
+
+#include "core.hpp"
+#include "dynamic/arena.hpp"
+#include "dynamic/dynamic_matrix.hpp"
+#include "dynamic/dynamic_tensor.hpp"
+#include "dynamic/dynamic_vector.hpp"
+
+#endif
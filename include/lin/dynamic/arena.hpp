@@ -0,0 +1,221 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/dynamic/arena.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_DYNAMIC_ARENA_HPP_
+#define LIN_DYNAMIC_ARENA_HPP_
+
+#include "../core.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace lin {
+
+/** @brief Alignment and granularity of every arena allocation in bytes.
+ *
+ *  Large enough for any fundamental type and for a full packet.
+ *
+ *  @sa Arena
+ *
+ *  @ingroup DYNAMIC
+ */
+constexpr size_t arena_alignment =
+    (LIN_PACKET_BYTES > alignof(std::max_align_t)) ? LIN_PACKET_BYTES : alignof(std::max_align_t);
+
+/** @brief Stack like allocator over a caller supplied buffer.
+ *
+ *  Allocations are carved off the top of the buffer. Freeing the most recent
+ *  allocation returns its memory to the arena. Any other freed allocation is
+ *  remembered and returned as soon as every allocation above it has been freed
+ *  too. Temporaries, which are destroyed in the reverse order they're created,
+ *  reuse the same memory this way.
+ *
+ *  Every allocation is aligned to, and rounded up to a multiple of,
+ *  lin::arena_alignment bytes so freed allocations never leave padding
+ *  behind.
+ *
+ *  The arena never owns its buffer and can't be copied or moved as tensors
+ *  allocated from it hold a pointer back to it.
+ *
+ *  @sa DynamicMatrix
+ *  @sa ArenaScope
+ *
+ *  @ingroup DYNAMIC
+ */
+class Arena {
+ private:
+  /* Freed allocation below the top of the arena. Written into the freed memory
+   * itself and linked in order of decreasing address.
+   */
+  struct Freed {
+    Freed *next;
+    size_t bytes;
+  };
+  static_assert(sizeof(Freed) <= arena_alignment,
+      "Freed allocations must be large enough to hold a free list entry");
+
+  unsigned char *_begin;
+  unsigned char *_top;
+  unsigned char *_end;
+  Freed *_freed;
+
+  static inline unsigned char *align_up(unsigned char *p) {
+    std::uintptr_t const u = reinterpret_cast<std::uintptr_t>(p);
+    return p + ((arena_alignment - u % arena_alignment) % arena_alignment);
+  }
+
+ public:
+  Arena() = delete;
+  Arena(Arena const &) = delete;
+  Arena(Arena &&) = delete;
+  Arena &operator=(Arena const &) = delete;
+  Arena &operator=(Arena &&) = delete;
+
+  /** @brief Creates an arena over an existing buffer.
+   *
+   *  @param buffer Buffer to allocate from.
+   *  @param bytes  Size of the buffer in bytes.
+   *
+   *  The buffer must outlive the arena and every tensor allocated from it.
+   */
+  Arena(void *buffer, size_t bytes)
+  : _begin(static_cast<unsigned char *>(buffer)), _top(nullptr), _end(_begin + bytes),
+    _freed(nullptr) {
+    _begin = align_up(_begin);
+    if (_begin > _end) _begin = _end;
+    _top = _begin;
+  }
+
+  /** @brief Allocates memory from the top of the arena.
+   *
+   *  @param bytes Requested size in bytes.
+   *
+   *  @return Pointer to the allocation or `nullptr` if the arena doesn't have
+   *          enough memory left.
+   */
+  inline void *allocate(size_t bytes) {
+    size_t const n = ((bytes + arena_alignment - 1) / arena_alignment) * arena_alignment;
+    if (n > size_t(_end - _top)) return nullptr;
+    void *const p = _top;
+    _top += n;
+    return p;
+  }
+
+  /** @brief Frees memory previously allocated from this arena.
+   *
+   *  @param p     Pointer to the allocation.
+   *  @param bytes Size of the allocation in bytes.
+   *
+   *  Freeing the most recent allocation also returns any previously freed
+   *  allocations directly beneath it.
+   */
+  inline void deallocate(void *p, size_t bytes) {
+    size_t const n = ((bytes + arena_alignment - 1) / arena_alignment) * arena_alignment;
+    unsigned char *const b = static_cast<unsigned char *>(p);
+    if (!n) return;
+
+    // Allocation below the top; remember it until the top unwinds down to it
+    if (b + n != _top) {
+      Freed **f = &_freed;
+      while (*f && reinterpret_cast<unsigned char *>(*f) > b) f = &(*f)->next;
+      *f = new (b) Freed{*f, n};
+      return;
+    }
+
+    _top = b;
+    while (_freed && reinterpret_cast<unsigned char *>(_freed) + _freed->bytes == _top) {
+      _top = reinterpret_cast<unsigned char *>(_freed);
+      _freed = _freed->next;
+    }
+  }
+
+  /** @brief Frees every allocation at once.
+   *
+   *  Tensors still holding memory from the arena must not be used afterwards.
+   */
+  inline void reset() {
+    _top = _begin;
+    _freed = nullptr;
+  }
+
+  /** @return Number of bytes currently allocated, including freed allocations
+   *          not yet returned to the arena.
+   */
+  inline size_t used() const {
+    return size_t(_top - _begin);
+  }
+
+  /** @return Number of bytes available in total.
+   */
+  inline size_t capacity() const {
+    return size_t(_end - _begin);
+  }
+};
+
+namespace internal {
+
+/* Arena temporaries of runtime sized tensors are allocated from on the calling
+ * thread.
+ */
+inline Arena *&_default_arena() {
+  static thread_local Arena *arena = nullptr;
+  return arena;
+}
+
+}  // namespace internal
+
+/** @brief Makes an arena the default for the current thread while in scope.
+ *
+ *  Runtime sized tensors constructed without an explicit arena, including the
+ *  temporaries lin creates while evaluating expressions such as
+ *  lin::internal::Stream::eval or aliased assignments, are allocated from the
+ *  default arena. Scopes nest and the previous default is restored when a
+ *  scope ends.
+ *
+ *  ~~~{.cpp}
+ *  alignas(64) static unsigned char buffer[1 << 24];
+ *  lin::Arena arena(buffer, sizeof(buffer));
+ *  lin::ArenaScope scope(arena);
+ *
+ *  lin::DynamicMatrixd A(arena, 1000, 1000), B(arena, 1000, 1000);
+ *  lin::DynamicMatrixd C = A * B;  // Allocated from the default arena
+ *  ~~~
+ *
+ *  @sa Arena
+ *
+ *  @ingroup DYNAMIC
+ */
+class ArenaScope {
+ private:
+  Arena *const previous;
+
+ public:
+  ArenaScope() = delete;
+  ArenaScope(ArenaScope const &) = delete;
+  ArenaScope(ArenaScope &&) = delete;
+  ArenaScope &operator=(ArenaScope const &) = delete;
+  ArenaScope &operator=(ArenaScope &&) = delete;
+
+  /** @brief Makes an arena the current thread's default.
+   *
+   *  @param arena Arena.
+   */
+  explicit ArenaScope(Arena &arena)
+  : previous(internal::_default_arena()) {
+    internal::_default_arena() = &arena;
+  }
+
+  /** @brief Restores the previous default arena.
+   */
+  ~ArenaScope() {
+    internal::_default_arena() = previous;
+  }
+};
+
+}  // namespace lin
+
+#endif
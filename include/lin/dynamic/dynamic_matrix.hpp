@@ -0,0 +1,108 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/dynamic/dynamic_matrix.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_DYNAMIC_DYNAMIC_MATRIX_HPP_
+#define LIN_DYNAMIC_DYNAMIC_MATRIX_HPP_
+
+#include "../core.hpp"
+#include "dynamic_tensor.hpp"
+
+#include <type_traits>
+
+namespace lin {
+
+/** @brief Runtime sized, arena backed matrix.
+ *
+ *  @tparam T %Matrix element type.
+ *  @tparam L Layout tag.
+ *
+ *  Both dimensions are chosen at runtime without a compile time bound and the
+ *  elements are allocated from an lin::Arena. Otherwise, it's used just like a
+ *  Matrix and works with every stream operation.
+ *
+ *  Runtime sized matrices only combine with other runtime sized tensors.
+ *  Expressions involving them evaluate to runtime sized temporaries allocated
+ *  from the current thread's default arena.
+ *
+ *  @sa internal::DynamicTensor
+ *  @sa internal::dynamic_dimension
+ *  @sa ArenaScope
+ *
+ *  @ingroup DYNAMIC
+ */
+template <typename T, class L = RowMajor>
+class DynamicMatrix : public internal::DynamicTensor<DynamicMatrix<T, L>> {
+  static_assert(internal::is_matrix<DynamicMatrix<T, L>>::value,
+      "Invalid DynamicMatrix<...> parameters");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef internal::traits<DynamicMatrix<T, L>> Traits;
+
+ protected:
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::derived;
+
+ public:
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::DynamicTensor;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::rows;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::cols;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::size;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::data;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::stride;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::eval;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::resize;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::arena;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::operator=;
+  using internal::DynamicTensor<DynamicMatrix<T, L>>::operator();
+
+  DynamicMatrix(DynamicMatrix<T, L> const &) = default;
+  DynamicMatrix(DynamicMatrix<T, L> &&) = default;
+  DynamicMatrix<T, L> &operator=(DynamicMatrix<T, L> const &) = default;
+  DynamicMatrix<T, L> &operator=(DynamicMatrix<T, L> &&) = default;
+};
+
+/** @weakgroup DYNAMIC
+ *  @{
+ */
+
+typedef DynamicMatrix<float> DynamicMatrixf;   ///< Runtime sized float matrix.
+typedef DynamicMatrix<double> DynamicMatrixd;  ///< Runtime sized double matrix.
+
+/** @}
+ */
+
+namespace internal {
+
+template <typename T, class L>
+struct _elem<DynamicMatrix<T, L>> {
+  typedef T type;
+};
+
+template <typename T, class L>
+struct _dims<DynamicMatrix<T, L>> {
+  static constexpr size_t rows = 0;
+  static constexpr size_t cols = 0;
+  static constexpr size_t max_rows = dynamic_dimension;
+  static constexpr size_t max_cols = dynamic_dimension;
+};
+
+template <typename T, class L>
+struct _layout<DynamicMatrix<T, L>> {
+  typedef L type;
+};
+
+template <class C>
+struct _eval<C, std::enable_if_t<conjunction<
+    is_matrix<C>, has_dynamic_dimensions<C>>::value>> {
+  typedef DynamicMatrix<_elem_t<C>> type;
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
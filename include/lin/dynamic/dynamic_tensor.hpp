@@ -0,0 +1,298 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/dynamic/dynamic_tensor.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_DYNAMIC_DYNAMIC_TENSOR_HPP_
+#define LIN_DYNAMIC_DYNAMIC_TENSOR_HPP_
+
+#include "../core.hpp"
+#include "arena.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @brief Arena backed tensor.
+ *
+ *  @tparam D Derived type.
+ *
+ *  Implements the internal::Base interface with elements allocated from an
+ *  lin::Arena rather than stored in a member array. Elements are stored
+ *  densely in the order given by internal::traits::layout. Only as many
+ *  elements as the tensor currently holds are allocated.
+ *
+ *  Copies allocate from the same arena as the tensor being copied. Moves take
+ *  over the other tensor's allocation, which leaves the other tensor without
+ *  elements; it may only be destroyed or assigned to afterwards. Move
+ *  assignments copy instead when this tensor already holds enough elements.
+ *
+ *  Constructors not taking an arena allocate from the current thread's default
+ *  arena as set by lin::ArenaScope. This is how lin's own temporaries of
+ *  runtime sized types are allocated.
+ *
+ *  If an arena runs out of memory, lin assertion errors will be triggered.
+ *
+ *  @sa internal::Base
+ *  @sa DynamicMatrix
+ *  @sa DynamicRowVector
+ *  @sa DynamicVector
+ *
+ *  @ingroup DYNAMIC
+ */
+template <class D>
+class DynamicTensor : public Base<D> {
+  static_assert(has_valid_traits<D>::value,
+      "Derived types to DynamicTensor<...> must have valid traits");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef traits<D> Traits;
+
+ private:
+  Arena *_arena;
+  typename Traits::elem_t *elems;
+  size_t capacity;
+
+  static inline Arena &default_arena() {
+    LIN_ASSERT(_default_arena() != nullptr);
+    return *_default_arena();
+  }
+
+  /* Replaces the current allocation with one holding at least n elements. The
+   * new elements are zero initialized unless requested otherwise.
+   */
+  inline void reserve(size_t n, bool zero = true) {
+    if (n <= capacity) return;
+
+    release();
+    elems = static_cast<typename Traits::elem_t *>(
+        _arena->allocate(n * sizeof(typename Traits::elem_t)));
+    LIN_ASSERT(elems != nullptr);
+    capacity = elems ? n : 0;
+    if (zero) std::fill_n(elems, capacity, typename Traits::elem_t(0));
+  }
+
+  inline void release() {
+    if (elems) _arena->deallocate(elems, capacity * sizeof(typename Traits::elem_t));
+    elems = nullptr;
+    capacity = 0;
+  }
+
+ protected:
+  using Base<D>::derived;
+
+ public:
+  using Base<D>::rows;
+  using Base<D>::cols;
+  using Base<D>::size;
+  using Base<D>::operator=;
+  using Base<D>::operator();
+  using Base<D>::data;
+  using Base<D>::stride;
+  using Base<D>::eval;
+
+  DynamicTensor() = delete;
+
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   *
+   *  The copy is allocated from the other tensor's arena.
+   */
+  DynamicTensor(DynamicTensor<D> const &t)
+  : Base<D>(t), _arena(t._arena), elems(nullptr), capacity(0) {
+    reserve(size(), false);
+    for (size_t i = 0; i < size(); i++) elems[i] = t.elems[i];
+  }
+
+  /** @brief Takes over another tensor's allocation.
+   *
+   *  @param t Other tensor.
+   */
+  DynamicTensor(DynamicTensor<D> &&t)
+  : Base<D>(t), _arena(t._arena), elems(t.elems), capacity(t.capacity) {
+    t.elems = nullptr;
+    t.capacity = 0;
+  }
+
+  /** @brief Copies another tensor's dimensions and elements.
+   *
+   *  @param t Other tensor.
+   *
+   *  @return Reference to this tensor.
+   *
+   *  This tensor is reallocated from its own arena if it doesn't hold enough
+   *  elements.
+   */
+  DynamicTensor<D> &operator=(DynamicTensor<D> const &t) {
+    if (this == &t) return *this;
+
+    resize(t.rows(), t.cols());
+    for (size_t i = 0; i < size(); i++) elems[i] = t.elems[i];
+    return *this;
+  }
+
+  /** @brief Moves another tensor's dimensions and elements into this one.
+   *
+   *  @param t Other tensor.
+   *
+   *  @return Reference to this tensor.
+   *
+   *  If this tensor already holds enough elements in the same arena, the
+   *  elements are copied and the other tensor keeps its allocation. Otherwise,
+   *  this tensor's allocation is freed and the other tensor's is taken over.
+   *  Repeatedly assigning evaluated temporaries to the same tensor therefore
+   *  doesn't grow the arena.
+   */
+  DynamicTensor<D> &operator=(DynamicTensor<D> &&t) {
+    if (this == &t) return *this;
+
+    Base<D>::operator=(t);
+    if (_arena == t._arena && capacity >= t.size()) {
+      for (size_t i = 0; i < size(); i++) elems[i] = t.elems[i];
+      return *this;
+    }
+
+    release();
+    _arena = t._arena;
+    elems = t.elems;
+    capacity = t.capacity;
+    t.elems = nullptr;
+    t.capacity = 0;
+    return *this;
+  }
+
+  /** @brief Returns the elements to the arena.
+   */
+  ~DynamicTensor() {
+    release();
+  }
+
+  /** @brief Constructs a tensor with zero initialized elements and the
+   *         requested dimensions.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param r     Initial row dimension.
+   *  @param c     Initial column dimension.
+   *
+   *  Lin assertion errors will be triggered if the requested dimensions aren't
+   *  possible given the tensor's traits.
+   */
+  DynamicTensor(Arena &arena, size_t r, size_t c)
+  : _arena(&arena), elems(nullptr), capacity(0) {
+    resize(r, c);
+  }
+
+  /** @brief Constructs a tensor with uninitialized elements and the requested
+   *         dimensions.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param r     Initial row dimension.
+   *  @param c     Initial column dimension.
+   *
+   *  @sa lin::uninitialized
+   */
+  DynamicTensor(Arena &arena, uninitialized_t, size_t r, size_t c)
+  : _arena(&arena), elems(nullptr), capacity(0) {
+    Base<D>::resize(r, c);
+    reserve(r * c, false);
+  }
+
+  /** @brief Constructs a tensor with zero initialized elements and the
+   *         requested dimensions in the default arena.
+   *
+   *  @param r Initial row dimension.
+   *  @param c Initial column dimension.
+   *
+   *  @sa lin::ArenaScope
+   */
+  DynamicTensor(size_t r, size_t c)
+  : DynamicTensor(default_arena(), r, c) { }
+
+  /** @brief Constructs a tensor with elements initialized from an initializer
+   *         list and the requested dimensions.
+   *
+   *  @tparam T    Element type of the initializer list.
+   *  @param  arena Arena the elements are allocated from.
+   *  @param  r     Initial row dimension.
+   *  @param  c     Initial column dimension.
+   *  @param  list  Initializer list.
+   *
+   *  @sa internal::Mapping::operator=(std::initializer_list<T> const &)
+   */
+  template <typename T>
+  DynamicTensor(Arena &arena, size_t r, size_t c, std::initializer_list<T> const &list)
+  : DynamicTensor(arena, r, c) {
+    derived() = list;
+  }
+
+  /** @brief Constructs a tensor by copying in dimensions and elements from
+   *         another tensor stream.
+   *
+   *  @tparam C     Other derived type.
+   *  @param  arena Arena the elements are allocated from.
+   *  @param  s     Other tensor stream.
+   *
+   *  @sa internal::Mapping::operator=(Stream<C> const &)
+   */
+  template <class C>
+  DynamicTensor(Arena &arena, Stream<C> const &s)
+  : DynamicTensor(arena, uninitialized, s.rows(), s.cols()) {
+    MappingNoAlias<D>{derived()} = s;
+  }
+
+  /** @brief Constructs a tensor by copying in dimensions and elements from
+   *         another tensor stream in the default arena.
+   *
+   *  @tparam C Other derived type.
+   *  @param  s Other tensor stream.
+   *
+   *  This is how runtime sized expressions are evaluated.
+   *
+   *  @sa lin::ArenaScope
+   *  @sa internal::Stream::eval
+   */
+  template <class C>
+  DynamicTensor(Stream<C> const &s)
+  : DynamicTensor(default_arena(), s) { }
+
+  /** @brief Resizes the tensor's dimensions.
+   *
+   *  @param r Number of rows.
+   *  @param c Number of columns.
+   *
+   *  If the tensor doesn't already hold enough elements, it's reallocated from
+   *  its arena and element values are reset to zero. Otherwise, element values
+   *  are left as is.
+   */
+  void resize(size_t r, size_t c) {
+    Base<D>::resize(r, c);
+    reserve(r * c);
+  }
+
+  /** @return Arena the elements are allocated from.
+   */
+  inline Arena &arena() const {
+    return *_arena;
+  }
+
+  /** @brief Retrives a pointer to the element backing array.
+   *
+   *  @returns Pointer to the backing array.
+   */
+  inline typename Traits::elem_t *data() {
+    return elems;
+  }
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
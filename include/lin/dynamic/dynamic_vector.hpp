@@ -0,0 +1,260 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/dynamic/dynamic_vector.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_DYNAMIC_DYNAMIC_VECTOR_HPP_
+#define LIN_DYNAMIC_DYNAMIC_VECTOR_HPP_
+
+#include "../core.hpp"
+#include "dynamic_tensor.hpp"
+
+#include <initializer_list>
+#include <type_traits>
+
+namespace lin {
+
+/** @brief Runtime sized, arena backed vector.
+ *
+ *  @tparam T %Vector element type.
+ *
+ *  The length is chosen at runtime without a compile time bound and the
+ *  elements are allocated from an lin::Arena.
+ *
+ *  @sa internal::DynamicTensor
+ *  @sa DynamicMatrix
+ *
+ *  @ingroup DYNAMIC
+ */
+template <typename T>
+class DynamicVector : public internal::DynamicTensor<DynamicVector<T>> {
+  static_assert(internal::is_col_vector<DynamicVector<T>>::value,
+      "Invalid DynamicVector<...> parameters");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef internal::traits<DynamicVector<T>> Traits;
+
+  /** @brief Vector traits information for this type.
+   *
+   *  @sa internal::vector_traits
+   */
+  typedef internal::vector_traits<DynamicVector<T>> VectorTraits;
+
+ protected:
+  using internal::DynamicTensor<DynamicVector<T>>::derived;
+
+ public:
+  using internal::DynamicTensor<DynamicVector<T>>::DynamicTensor;
+  using internal::DynamicTensor<DynamicVector<T>>::rows;
+  using internal::DynamicTensor<DynamicVector<T>>::cols;
+  using internal::DynamicTensor<DynamicVector<T>>::size;
+  using internal::DynamicTensor<DynamicVector<T>>::data;
+  using internal::DynamicTensor<DynamicVector<T>>::stride;
+  using internal::DynamicTensor<DynamicVector<T>>::eval;
+  using internal::DynamicTensor<DynamicVector<T>>::resize;
+  using internal::DynamicTensor<DynamicVector<T>>::arena;
+  using internal::DynamicTensor<DynamicVector<T>>::operator=;
+  using internal::DynamicTensor<DynamicVector<T>>::operator();
+
+  DynamicVector(DynamicVector<T> const &) = default;
+  DynamicVector(DynamicVector<T> &&) = default;
+  DynamicVector<T> &operator=(DynamicVector<T> const &) = default;
+  DynamicVector<T> &operator=(DynamicVector<T> &&) = default;
+
+  /** @brief Constructs a vector with zero initialized elements and the
+   *         requested length.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param n     Initial length.
+   */
+  DynamicVector(Arena &arena, size_t n)
+  : internal::DynamicTensor<DynamicVector<T>>(arena, n, 1) { }
+
+  /** @brief Constructs a vector with zero initialized elements and the
+   *         requested length in the default arena.
+   *
+   *  @param n Initial length.
+   *
+   *  @sa ArenaScope
+   */
+  explicit DynamicVector(size_t n)
+  : internal::DynamicTensor<DynamicVector<T>>(n, 1) { }
+
+  /** @brief Constructs a vector with elements initialized from an initializer
+   *         list and the requested length.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param n     Initial length.
+   *  @param list  Initializer list.
+   *
+   *  @sa internal::Mapping::operator=(std::initializer_list<T> const &)
+   */
+  template <typename U>
+  DynamicVector(Arena &arena, size_t n, std::initializer_list<U> const &list)
+  : internal::DynamicTensor<DynamicVector<T>>(arena, n, 1, list) { }
+
+  /** @brief Resizes the vector's length.
+   *
+   *  @param n Length.
+   *
+   *  @sa internal::DynamicTensor::resize
+   */
+  void resize(size_t n) {
+    resize(n, 1);
+  }
+};
+
+/** @brief Runtime sized, arena backed row vector.
+ *
+ *  @tparam T Row vector element type.
+ *
+ *  The length is chosen at runtime without a compile time bound and the
+ *  elements are allocated from an lin::Arena.
+ *
+ *  @sa internal::DynamicTensor
+ *  @sa DynamicMatrix
+ *
+ *  @ingroup DYNAMIC
+ */
+template <typename T>
+class DynamicRowVector : public internal::DynamicTensor<DynamicRowVector<T>> {
+  static_assert(internal::is_row_vector<DynamicRowVector<T>>::value,
+      "Invalid DynamicRowVector<...> parameters");
+
+ public:
+  /** @brief Traits information for this type.
+   *
+   *  @sa internal::traits
+   */
+  typedef internal::traits<DynamicRowVector<T>> Traits;
+
+  /** @brief Vector traits information for this type.
+   *
+   *  @sa internal::vector_traits
+   */
+  typedef internal::vector_traits<DynamicRowVector<T>> VectorTraits;
+
+ protected:
+  using internal::DynamicTensor<DynamicRowVector<T>>::derived;
+
+ public:
+  using internal::DynamicTensor<DynamicRowVector<T>>::DynamicTensor;
+  using internal::DynamicTensor<DynamicRowVector<T>>::rows;
+  using internal::DynamicTensor<DynamicRowVector<T>>::cols;
+  using internal::DynamicTensor<DynamicRowVector<T>>::size;
+  using internal::DynamicTensor<DynamicRowVector<T>>::data;
+  using internal::DynamicTensor<DynamicRowVector<T>>::stride;
+  using internal::DynamicTensor<DynamicRowVector<T>>::eval;
+  using internal::DynamicTensor<DynamicRowVector<T>>::resize;
+  using internal::DynamicTensor<DynamicRowVector<T>>::arena;
+  using internal::DynamicTensor<DynamicRowVector<T>>::operator=;
+  using internal::DynamicTensor<DynamicRowVector<T>>::operator();
+
+  DynamicRowVector(DynamicRowVector<T> const &) = default;
+  DynamicRowVector(DynamicRowVector<T> &&) = default;
+  DynamicRowVector<T> &operator=(DynamicRowVector<T> const &) = default;
+  DynamicRowVector<T> &operator=(DynamicRowVector<T> &&) = default;
+
+  /** @brief Constructs a row vector with zero initialized elements and the
+   *         requested length.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param n     Initial length.
+   */
+  DynamicRowVector(Arena &arena, size_t n)
+  : internal::DynamicTensor<DynamicRowVector<T>>(arena, 1, n) { }
+
+  /** @brief Constructs a row vector with zero initialized elements and the
+   *         requested length in the default arena.
+   *
+   *  @param n Initial length.
+   *
+   *  @sa ArenaScope
+   */
+  explicit DynamicRowVector(size_t n)
+  : internal::DynamicTensor<DynamicRowVector<T>>(1, n) { }
+
+  /** @brief Constructs a row vector with elements initialized from an
+   *         initializer list and the requested length.
+   *
+   *  @param arena Arena the elements are allocated from.
+   *  @param n     Initial length.
+   *  @param list  Initializer list.
+   *
+   *  @sa internal::Mapping::operator=(std::initializer_list<T> const &)
+   */
+  template <typename U>
+  DynamicRowVector(Arena &arena, size_t n, std::initializer_list<U> const &list)
+  : internal::DynamicTensor<DynamicRowVector<T>>(arena, 1, n, list) { }
+
+  /** @brief Resizes the row vector's length.
+   *
+   *  @param n Length.
+   *
+   *  @sa internal::DynamicTensor::resize
+   */
+  void resize(size_t n) {
+    resize(1, n);
+  }
+};
+
+/** @weakgroup DYNAMIC
+ *  @{
+ */
+
+typedef DynamicVector<float> DynamicVectorf;         ///< Runtime sized float vector.
+typedef DynamicVector<double> DynamicVectord;        ///< Runtime sized double vector.
+typedef DynamicRowVector<float> DynamicRowVectorf;   ///< Runtime sized float row vector.
+typedef DynamicRowVector<double> DynamicRowVectord;  ///< Runtime sized double row vector.
+
+/** @}
+ */
+
+namespace internal {
+
+template <typename T>
+struct _elem<DynamicVector<T>> {
+  typedef T type;
+};
+
+template <typename T>
+struct _dims<DynamicVector<T>> {
+  static constexpr size_t rows = 0;
+  static constexpr size_t cols = 1;
+  static constexpr size_t max_rows = dynamic_dimension;
+  static constexpr size_t max_cols = 1;
+};
+
+template <class C>
+struct _eval<C, std::enable_if_t<conjunction<
+    is_col_vector<C>, has_dynamic_dimensions<C>>::value>> {
+  typedef DynamicVector<_elem_t<C>> type;
+};
+
+template <typename T>
+struct _elem<DynamicRowVector<T>> {
+  typedef T type;
+};
+
+template <typename T>
+struct _dims<DynamicRowVector<T>> {
+  static constexpr size_t rows = 1;
+  static constexpr size_t cols = 0;
+  static constexpr size_t max_rows = 1;
+  static constexpr size_t max_cols = dynamic_dimension;
+};
+
+template <class C>
+struct _eval<C, std::enable_if_t<conjunction<
+    is_row_vector<C>, has_dynamic_dimensions<C>>::value>> {
+  typedef DynamicRowVector<_elem_t<C>> type;
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -8,6 +8,9 @@
 #define LIN_FACTORIZATIONS_HPP_
 
 #include "factorizations/chol.hpp"
+#include "factorizations/ldlt.hpp"
+#include "factorizations/lu.hpp"
 #include "factorizations/qr.hpp"
+#include "factorizations/qr_update.hpp"
 
 #endif
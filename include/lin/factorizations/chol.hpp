@@ -2,8 +2,6 @@
  *  @author Kyle Krol
  *  Defines a cholesky factorization algorithm for tensor types. */
 
-// TODO : Documentation for this entire fil
-
 #ifndef LIN_FACTORIZATIONS_CHOL_HPP_
 #define LIN_FACTORIZATIONS_CHOL_HPP_
 
@@ -12,7 +10,9 @@
 #include "../references.hpp"
 
 #include <cmath>
+#include <initializer_list>
 #include <type_traits>
+#include <utility>
 
 namespace lin {
 namespace internal {
@@ -21,12 +21,59 @@ namespace internal {
 template <class C>
 struct can_chol : conjunction<is_matrix<C>, is_square<C>> { };
 
+/** @struct can_chol_update
+ *  Used to test whether or not the provided types can be fed to the rank one
+ *  Cholesky update and downdate. */
+template <class C, class D>
+struct can_chol_update : conjunction<
+    can_chol<C>, is_col_vector<D>, have_same_elements<C, D>
+  > { };
+
+/** @brief Rows and columns of the diagonal blocks the Cholesky factorization
+ *         works through.
+ */
+constexpr size_t chol_block = 16;
+
 }  // namespace internal
 
-/** @fn chol */
+/** @brief Computes the Cholesky factorization of a symmetric, positive definite
+ *         matrix in place.
+ *
+ *  @return Zero on success and, if a pivot isn't positive, its index plus
+ *          one.
+ *
+ *  Works through `internal::chol_block` columns at a time, updating the
+ *  trailing submatrix with a register blocked kernel. Above the diagonal is
+ *  zeroed even if a pivot isn't positive, in which case the lower triangle is
+ *  only partially factorized.
+ *
+ *  Symmetric types are factorized within their packed lower triangle and
+ *  still read the mirrored lower triangle above the diagonal. Their factor is
+ *  only valid to functions reading the lower triangle, such as forward_sub;
+ *  full matrix uses like `L * transpose(L)` or `fro(L)` are wrong.
+ */
 template <class C, std::enable_if_t<internal::can_chol<C>::value, size_t> = 0>
 constexpr int chol(internal::Mapping<C> &L);
 
+/** @brief Updates a Cholesky factor in place to that of \f$L L^T + x x^T\f$.
+ *
+ *  @return Zero.
+ *
+ *  @sa chol_downdate
+ */
+template <class C, class D, std::enable_if_t<internal::can_chol_update<C, D>::value, size_t> = 0>
+constexpr int chol_update(internal::Mapping<C> &L, internal::Stream<D> const &x);
+
+/** @brief Downdates a Cholesky factor in place to that of \f$L L^T - x x^T\f$.
+ *
+ *  @return Zero on success and, if the result isn't positive definite, the
+ *          index of the first pivot that isn't positive plus one.
+ *
+ *  @sa chol_update
+ */
+template <class C, class D, std::enable_if_t<internal::can_chol_update<C, D>::value, size_t> = 0>
+constexpr int chol_downdate(internal::Mapping<C> &L, internal::Stream<D> const &x);
+
 }  // namespace lin
 
 #include "inl/chol.inl"
@@ -5,40 +5,264 @@
 #include "../chol.hpp"
 
 namespace lin {
+namespace internal {
 
-// Source: https://en.wikipedia.org/wiki/Cholesky_decomposition
-// Cholesky–Banachiewicz algorithm
-template <class C, std::enable_if_t<internal::can_chol<C>::value, size_t>>
-constexpr int chol(internal::Mapping<C> &L) {
-  LIN_ASSERT(L.rows() == L.cols() /* L must be square */);
+template <typename T, typename U>
+using _greater_expr = decltype(std::declval<T const &>() > std::declval<U const &>());
+
+/* Whether a pivot is positive. Element types that can't be compared, such as
+ * batch lanes, are assumed to be.
+ */
+template <typename T>
+constexpr bool _chol_pivot(T const &d, std::true_type) {
+  return d > T(0);
+}
+
+template <typename T>
+constexpr bool _chol_pivot(T const &, std::false_type) {
+  return true;
+}
+
+/* Accumulates x * U(p, j:j+NR) into a row of accumulators.
+ */
+template <size_t NR, class C>
+constexpr void _chol_row(Mapping<C> &L, typename C::Traits::elem_t const &x,
+    size_t p, size_t j, typename C::Traits::elem_t (&acc)[NR]) {
+  for (size_t c = 0; c < NR; c++) acc[c] = fmadd(x, L(p, j + c), acc[c]);
+}
+
+/* Subtracts L(i:i+MR, k:k+kb) * U(k:k+kb, j:j+NR) from L(i:i+MR, j:j+NR) where
+ * the transposed panel U is stored in the upper triangle. Rows are unrolled so
+ * the accumulators stay in registers.
+ */
+template <size_t NR, class C, size_t... R>
+constexpr void _chol_update(Mapping<C> &L, size_t i, size_t j, size_t k, size_t kb,
+    std::index_sequence<R...>) {
+  typedef typename C::Traits::elem_t Elem;
+
+  Elem acc[sizeof...(R)][NR] = { };
+  for (size_t p = k; p < k + kb; p++)
+    (void) std::initializer_list<int>{ (_chol_row<NR>(L, L(i + R, p), p, j, acc[R]), 0)... };
+  for (size_t r = 0; r < sizeof...(R); r++)
+    for (size_t c = 0; c < NR; c++) L(i + r, j + c) = L(i + r, j + c) - acc[r][c];
+}
+
+/* Subtracts x * U(p, b:e) from U(j, b:e) where U is the transposed panel
+ * stored in the upper triangle. Works through fixed size chunks so the
+ * subtraction is vectorized.
+ */
+template <size_t N, class C>
+constexpr void _chol_axpy(Mapping<C> &L, size_t j, size_t p, size_t b, size_t e,
+    typename C::Traits::elem_t const &x) {
+  typedef typename C::Traits::elem_t Elem;
+
+  size_t i = b;
+  for (; i + N <= e; i += N) {
+    Elem y[N] = { };
+    for (size_t c = 0; c < N; c++) y[c] = L(p, i + c);
+    for (size_t c = 0; c < N; c++) y[c] = L(j, i + c) - x * y[c];
+    for (size_t c = 0; c < N; c++) L(j, i + c) = y[c];
+  }
+  for (; i < e; i++) L(j, i) = L(j, i) - x * L(p, i);
+}
+
+/* Divides U(j, b:e) by d where U is the transposed panel stored in the upper
+ * triangle.
+ */
+template <size_t N, class C>
+constexpr void _chol_scale(Mapping<C> &L, size_t j, size_t b, size_t e,
+    typename C::Traits::elem_t const &d) {
+  typedef typename C::Traits::elem_t Elem;
+
+  size_t i = b;
+  for (; i + N <= e; i += N) {
+    Elem y[N] = { };
+    for (size_t c = 0; c < N; c++) y[c] = L(j, i + c) / d;
+    for (size_t c = 0; c < N; c++) L(j, i + c) = y[c];
+  }
+  for (; i < e; i++) L(j, i) = L(j, i) / d;
+}
+
+/* Dot product of the first n elements of x and y accumulated in N
+ * independent partial sums so the loop is vectorized.
+ */
+template <size_t N, typename T>
+constexpr T _chol_dot(T const *x, T const *y, size_t n) {
+  T acc[N] = { };
+  size_t p = 0;
+  for (; p + N <= n; p += N)
+    for (size_t c = 0; c < N; c++) acc[c] = fmadd(x[p + c], y[p + c], acc[c]);
+
+  T r = T(0);
+  for (; p < n; p++) r = fmadd(x[p], y[p], r);
+  for (size_t c = 0; c < N; c++) r = r + acc[c];
+  return r;
+}
+
+/* Sweeps rotations down the columns of L, each one folding an element of the
+ * working vector into the diagonal. The sign selects an update or a downdate.
+ */
+template <class C, class D>
+constexpr int _chol_rotate(Mapping<C> &L, Stream<D> const &x, int sign) {
+  typedef typename C::Traits::elem_t Elem;
+  typedef is_detected<_greater_expr, Elem, Elem> Comparable;
+  using std::sqrt;
+
+  traits_eval_t<D> w(x);
+  size_t const n = L.rows();
+  for (size_t k = 0; k < n; k++) {
+    Elem const l = L(k, k);
+    Elem const d = l * l + Elem(sign) * w(k) * w(k);
+    if (!_chol_pivot(d, Comparable())) return int(k + 1);
+
+    Elem const r = sqrt(d);
+    Elem const c = r / l;
+    Elem const s = w(k) / l;
+    Elem const t = Elem(sign) * s;
+    Elem const u = l / r;
+    L(k, k) = r;
+
+    for (size_t i = k + 1; i < n; i++) {
+      Elem const y = (L(i, k) + t * w(i)) * u;
+      w(i) = c * w(i) - s * y;
+      L(i, k) = y;
+    }
+  }
+
+  return 0;
+}
 
-  // Useful traits information
-  constexpr size_t C_max_cols = C::Traits::max_cols;
+/* Sets above the main diagonal, used as scratch while factorizing, to zeros.
+ */
+template <class C>
+constexpr void _chol_zero_upper(Mapping<C> &L) {
+  size_t const n = L.rows();
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = i + 1; j < n; j++) L(i, j) = 0;
+}
+
+/* Blocked factorization of a dense matrix.
+ */
+template <class C>
+constexpr int _chol(Mapping<C> &L, std::false_type) {
   typedef typename C::Traits::elem_t Elem;
+  typedef is_detected<_greater_expr, Elem, Elem> Comparable;
+  using std::sqrt;
+
+  constexpr size_t NB = chol_block;
+  constexpr size_t MR = gemm_block_rows;
+  constexpr size_t NR = gemm_block_cols<Elem>::value;
+  size_t const n = L.rows();
+
+  for (size_t k = 0; k < n; k += NB) {
+    size_t const kb = (n - k < NB) ? n - k : NB;
+    size_t const kn = k + kb;
 
-  // Set above the main diagonal to zeros
-  for (size_t i = 0; i < L.rows(); i++)
-    for (size_t j = i + 1; j < L.cols(); j++) L(i, j) = 0;
+    // Cholesky–Banachiewicz on the diagonal block L(k:kn, k:kn)
+    for (size_t i = k; i < kn; i++) {
+      for (size_t j = k; j < i; j++) {
+        Elem x = L(i, j);
+        for (size_t p = k; p < j; p++) x = x - L(i, p) * L(j, p);
+        L(i, j) = x / L(j, j);
+      }
 
-  // L(0, 0)
-  L(0, 0) = std::sqrt(L(0, 0));
+      Elem d = L(i, i);
+      for (size_t p = k; p < i; p++) d = d - L(i, p) * L(i, p);
+      if (!_chol_pivot(d, Comparable())) {
+        _chol_zero_upper(L);
+        return int(i + 1);
+      }
+      L(i, i) = sqrt(d);
+    }
+
+    // Panel L(kn:, k:kn) solved for as its transpose U(k:kn, kn:) in the upper
+    // triangle so each update is a contiguous row operation
+    for (size_t i = kn; i < n; i++)
+      for (size_t j = k; j < kn; j++) L(j, i) = L(i, j);
+    for (size_t j = k; j < kn; j++) {
+      for (size_t p = k; p < j; p++) _chol_axpy<NR>(L, j, p, kn, n, L(j, p));
+      _chol_scale<NR>(L, j, kn, n, L(j, j));
+    }
+    for (size_t i = kn; i < n; i++)
+      for (size_t j = k; j < kn; j++) L(i, j) = L(j, i);
+
+    // Trailing update of L(kn:, kn:) on and below the diagonal. Blocks
+    // straddling the diagonal also overwrite some of the upper triangle which
+    // is only ever used as scratch.
+    size_t i = kn;
+    for (; i + MR <= n; i += MR) {
+      size_t j = kn;
+      for (; j < i + MR && j + NR <= n; j += NR)
+        _chol_update<NR>(L, i, j, k, kb, std::make_index_sequence<MR>());
+      for (size_t r = 0; r < MR; r++) {
+        for (size_t c = j; c <= i + r; c++) {
+          Elem x = L(i + r, c);
+          for (size_t p = k; p < kn; p++) x = x - L(i + r, p) * L(p, c);
+          L(i + r, c) = x;
+        }
+      }
+    }
+    for (; i < n; i++) {
+      for (size_t c = kn; c <= i; c++) {
+        Elem x = L(i, c);
+        for (size_t p = k; p < kn; p++) x = x - L(i, p) * L(p, c);
+        L(i, c) = x;
+      }
+    }
+  }
+
+  _chol_zero_upper(L);
+  return 0;
+}
+
+/* Cholesky–Banachiewicz factorization of a packed symmetric matrix. Rows of
+ * the packed lower triangle are contiguous so every element is a contiguous
+ * dot product of two rows.
+ */
+template <class C>
+constexpr int _chol(Mapping<C> &L, std::true_type) {
+  typedef typename C::Traits::elem_t Elem;
+  typedef is_detected<_greater_expr, Elem, Elem> Comparable;
+  using std::sqrt;
 
-  // L(1:, :)
-  for (size_t i = 1; i < L.rows(); i++) {
-    // L(i, 0)
-    L(i, 0) = L(i, 0) / L(0, 0);
+  constexpr size_t N = gemm_block_cols<Elem>::value;
+  Elem *const a = static_cast<C &>(L).packed();
+  size_t const n = L.rows();
 
-    // L(i, 1:i-1)
-    for (size_t j = 1; j < i; j++)
-      // L(i, j)
-      L(i, j) = ( L(i, j) -
-          dot(ref<RowVector<Elem, 0, C_max_cols>>(L, j, 0, j), ref<RowVector<Elem, 0, C_max_cols>>(L, i, 0, j))
-        ) / L(j, j);
+  for (size_t i = 0, ri = 0; i < n; ri += ++i) {
+    for (size_t j = 0, rj = 0; j < i; rj += ++j)
+      a[ri + j] = (a[ri + j] - _chol_dot<N>(a + ri, a + rj, j)) / a[rj + j];
 
-    // L(i, i)
-    L(i, i) = std::sqrt(L(i, i) - fro(ref<RowVector<Elem, 0, C_max_cols>>(L, i, 0, i)));
+    Elem const d = a[ri + i] - _chol_dot<N>(a + ri, a + ri, i);
+    if (!_chol_pivot(d, Comparable())) return int(i + 1);
+    a[ri + i] = sqrt(d);
   }
 
   return 0;
 }
+
+}  // namespace internal
+
+template <class C, std::enable_if_t<internal::can_chol<C>::value, size_t>>
+constexpr int chol(internal::Mapping<C> &L) {
+  LIN_ASSERT(L.rows() == L.cols() /* L must be square */);
+
+  return internal::_chol(L, internal::is_symmetric<C>());
+}
+
+template <class C, class D, std::enable_if_t<internal::can_chol_update<C, D>::value, size_t>>
+constexpr int chol_update(internal::Mapping<C> &L, internal::Stream<D> const &x) {
+  LIN_ASSERT(L.rows() == L.cols() /* L must be square */);
+  LIN_ASSERT(L.rows() == x.rows() /* x rows doesn't match in chol_update(...) */);
+
+  return internal::_chol_rotate(L, x, 1);
+}
+
+template <class C, class D, std::enable_if_t<internal::can_chol_update<C, D>::value, size_t>>
+constexpr int chol_downdate(internal::Mapping<C> &L, internal::Stream<D> const &x) {
+  LIN_ASSERT(L.rows() == L.cols() /* L must be square */);
+  LIN_ASSERT(L.rows() == x.rows() /* x rows doesn't match in chol_downdate(...) */);
+
+  return internal::_chol_rotate(L, x, -1);
+}
 }  // namespace lin
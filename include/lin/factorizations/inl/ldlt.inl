@@ -0,0 +1,129 @@
+/** @file lin/factorizations/inl/ldlt.inl
+ *  @author Kyle Krol
+ *  See %lin/factorizations/ldlt.hpp for more information. */
+
+#include "../ldlt.hpp"
+
+namespace lin {
+namespace internal {
+
+template <typename T, typename U>
+using _less_expr = decltype(std::declval<T const &>() < std::declval<U const &>());
+
+/* Largest magnitude along the diagonal scaled by the dimension and machine
+ * epsilon. Pivots within this tolerance of zero are treated as zero.
+ */
+template <class C>
+constexpr traits_elem_t<C> _ldlt_tol(Mapping<C> const &L, std::true_type) {
+  typedef traits_elem_t<C> Elem;
+
+  Elem max = Elem(0);
+  for (size_t i = 0; i < L.rows(); i++) {
+    Elem const d = (L(i, i) < Elem(0)) ? -L(i, i) : L(i, i);
+    if (max < d) max = d;
+  }
+  return Elem(L.rows()) * std::numeric_limits<Elem>::epsilon() * max;
+}
+
+template <class C>
+constexpr traits_elem_t<C> _ldlt_tol(Mapping<C> const &, std::false_type) {
+  return traits_elem_t<C>(0);
+}
+
+/* Sign of a pivot given a tolerance. Element types that can't be compared,
+ * such as batch lanes, are assumed to be positive.
+ */
+template <typename T>
+constexpr int _ldlt_sign(T const &d, T const &tol, std::true_type) {
+  return (d < -tol) ? -1 : ((tol < d) ? 1 : 0);
+}
+
+template <typename T>
+constexpr int _ldlt_sign(T const &, T const &, std::false_type) {
+  return 1;
+}
+
+}  // namespace internal
+
+template <class C, std::enable_if_t<internal::can_ldlt<C>::value, size_t>>
+constexpr int ldlt(internal::Mapping<C> &L) {
+  LIN_ASSERT(L.rows() == L.cols() /* L must be square */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+  typedef internal::is_detected<internal::_less_expr, Elem, Elem> Comparable;
+
+  size_t const n = L.rows();
+  Elem const tol = internal::_ldlt_tol(L, Comparable());
+  for (size_t j = 0; j < n; j++) {
+    // L(j, :j) * D(:j) is kept in the upper triangle as L(:j, j)
+    Elem d = L(j, j);
+    for (size_t p = 0; p < j; p++) {
+      L(p, j) = L(j, p) * L(p, p);
+      d = d - L(j, p) * L(p, j);
+    }
+
+    int const sign = internal::_ldlt_sign(d, tol, Comparable());
+    if (sign < 0) return int(j + 1);
+    L(j, j) = sign ? d : Elem(0);
+
+    for (size_t i = j + 1; i < n; i++) {
+      if (sign == 0) {
+        L(i, j) = 0;
+        continue;
+      }
+
+      Elem x = L(i, j);
+      for (size_t p = 0; p < j; p++) x = x - L(i, p) * L(p, j);
+      L(i, j) = x / d;
+    }
+  }
+
+  // Set above the main diagonal to zeros
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = i + 1; j < n; j++) L(i, j) = 0;
+
+  return 0;
+}
+
+template <class C, class D, class E, std::enable_if_t<internal::can_ldlt_solve<C, D, E>::value, size_t>>
+constexpr int ldlt_solve(internal::Mapping<C> const &LD, internal::Mapping<D> &X, internal::Stream<E> const &Y) {
+  LIN_ASSERT(LD.rows() == LD.cols());
+  LIN_ASSERT(LD.cols() == Y.rows());
+  LIN_ASSERT(Y.rows() == X.rows());
+  LIN_ASSERT(Y.cols() == X.cols());
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+
+  size_t const n = X.rows();
+  size_t const m = X.cols();
+  X = Y;
+
+  // Forward substitution with the unit lower triangle
+  internal::substitution_lower(internal::substitution_normal<C>{LD}, X, true);
+
+  // Diagonal scale. Pivots ldlt treated as zero were stored as exact zeros.
+  int status = 0;
+  for (size_t i = 0; i < n; i++) {
+    Elem const d = LD(i, i);
+    if (d == Elem(0)) {
+      if (!status) status = int(i + 1);
+      for (size_t c = 0; c < m; c++) X(i, c) = 0;
+    } else {
+      for (size_t c = 0; c < m; c++) X(i, c) = X(i, c) / d;
+    }
+  }
+
+  // Backward substitution with the transpose of the unit lower triangle
+  internal::substitution_upper(internal::substitution_transposed<C>{LD}, X, true);
+
+  return status;
+}
+
+template <class C, class D, class E, std::enable_if_t<internal::can_ldlt_solve<C, D, E>::value, size_t>>
+constexpr int ldlt_solve(internal::Mapping<C> const &LD, internal::Base<D> &X, internal::Stream<E> const &Y) {
+  X.resize(Y.rows(), Y.cols());
+  return ldlt_solve(LD, static_cast<internal::Mapping<D> &>(X), Y);
+}
+}  // namespace lin
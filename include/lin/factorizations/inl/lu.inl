@@ -0,0 +1,120 @@
+/** @file lin/factorizations/inl/lu.inl
+ *  @author Kyle Krol
+ *  See %lin/factorizations/lu.hpp for more information. */
+
+#include "../lu.hpp"
+
+namespace lin {
+namespace internal {
+
+/* Interchanges rows i and j.
+ */
+template <class C>
+constexpr void _lu_swap(Mapping<C> &A, size_t i, size_t j) {
+  for (size_t c = 0; c < A.cols(); c++) {
+    auto const x = A(i, c);
+    A(i, c) = A(j, c);
+    A(j, c) = x;
+  }
+}
+
+/* Subtracts x * A(p, b:e) from A(i, b:e). Works through fixed size chunks so
+ * the subtraction is vectorized.
+ */
+template <size_t N, class C>
+constexpr void _lu_axpy(Mapping<C> &A, size_t i, size_t p, size_t b, size_t e,
+    typename C::Traits::elem_t const &x) {
+  typedef typename C::Traits::elem_t Elem;
+
+  size_t j = b;
+  for (; j + N <= e; j += N) {
+    Elem y[N] = { };
+    for (size_t c = 0; c < N; c++) y[c] = A(p, j + c);
+    for (size_t c = 0; c < N; c++) y[c] = A(i, j + c) - x * y[c];
+    for (size_t c = 0; c < N; c++) A(i, j + c) = y[c];
+  }
+  for (; j < e; j++) A(i, j) = A(i, j) - x * A(p, j);
+}
+
+}  // namespace internal
+
+template <class C, class D, std::enable_if_t<internal::can_lu<C, D>::value, size_t>>
+constexpr int lu(internal::Mapping<C> &A, internal::Mapping<D> &P) {
+  LIN_ASSERT(A.rows() == A.cols() /* A must be square */);
+  LIN_ASSERT(A.rows() == P.rows() /* P rows doesn't match in lu(...) */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+  typedef typename D::Traits::elem_t Index;
+  using std::abs;
+
+  constexpr size_t N = internal::gemm_block_cols<Elem>::value;
+  size_t const n = A.rows();
+
+  int status = 0;
+  for (size_t k = 0; k < n; k++) {
+    // Row with the element of largest magnitude on or below the diagonal
+    size_t p = k;
+    Elem a = abs(A(k, k));
+    for (size_t i = k + 1; i < n; i++) {
+      Elem const b = abs(A(i, k));
+      if (b > a) {
+        p = i;
+        a = b;
+      }
+    }
+
+    P(k) = Index(p);
+    if (a == Elem(0)) {
+      if (!status) status = int(k + 1);
+      continue;
+    }
+    if (p != k) internal::_lu_swap(A, k, p);
+
+    // Eliminate below the pivot a row at a time
+    Elem const d = A(k, k);
+    for (size_t i = k + 1; i < n; i++) {
+      Elem const x = A(i, k) / d;
+      A(i, k) = x;
+      internal::_lu_axpy<N>(A, i, k, k + 1, n, x);
+    }
+  }
+
+  return status;
+}
+
+template <class C, class D, std::enable_if_t<internal::can_lu<C, D>::value, size_t>>
+constexpr int lu(internal::Mapping<C> &A, internal::Base<D> &P) {
+  P.resize(A.rows(), 1);
+  return lu(A, static_cast<internal::Mapping<D> &>(P));
+}
+
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_lu_solve<C, D, E, F>::value, size_t>>
+constexpr int lu_solve(internal::Mapping<C> const &LU, internal::Mapping<D> const &P, internal::Mapping<E> &X, internal::Stream<F> const &Y) {
+  LIN_ASSERT(LU.rows() == LU.cols());
+  LIN_ASSERT(LU.rows() == P.rows());
+  LIN_ASSERT(LU.cols() == Y.rows());
+  LIN_ASSERT(Y.rows() == X.rows());
+  LIN_ASSERT(Y.cols() == X.cols());
+
+  size_t const status = internal::substitution_singular(LU);
+  if (status) return int(status);
+
+  // Apply the row interchanges in order
+  X = Y;
+  for (size_t k = 0; k < X.rows(); k++)
+    if (size_t(P(k)) != k) internal::_lu_swap(X, k, size_t(P(k)));
+
+  // Forward substitution with the unit lower triangle
+  internal::substitution_lower(internal::substitution_normal<C>{LU}, X, true);
+
+  // Backward substitution with the upper triangle in place
+  return int(backward_sub(LU, X, X));
+}
+
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_lu_solve<C, D, E, F>::value, size_t>>
+constexpr int lu_solve(internal::Mapping<C> const &LU, internal::Mapping<D> const &P, internal::Base<E> &X, internal::Stream<F> const &Y) {
+  X.resize(Y.rows(), Y.cols());
+  return lu_solve(LU, P, static_cast<internal::Mapping<E> &>(X), Y);
+}
+}  // namespace lin
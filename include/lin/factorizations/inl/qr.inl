@@ -5,6 +5,139 @@
 #include "../qr.hpp"
 
 namespace lin {
+namespace internal {
+
+/* Columns of the operand a block of reflectors is applied to at once.
+ */
+constexpr size_t _qr_cols = 16;
+
+/* Loads row i of the block of Householder vectors V(:, k:k+kb) stored below
+ * the diagonal of a compact factorization. The unit diagonal and the zeros
+ * above it are implied.
+ */
+template <class C>
+constexpr void _qr_row(Mapping<C> const &V, size_t i, size_t k, size_t kb,
+    typename C::Traits::elem_t (&v)[qr_block]) {
+  typedef typename C::Traits::elem_t Elem;
+
+  for (size_t r = 0; r < kb; r++)
+    v[r] = (i > k + r) ? V(i, k + r) : ((i == k + r) ? Elem(1) : Elem(0));
+}
+
+/* Computes the Householder reflector zeroing A(k+1:, k). The vector is
+ * stored below the diagonal and the remaining element on the diagonal.
+ */
+template <class C, class D>
+constexpr void _qr_reflector(Mapping<C> &A, Mapping<D> &tau, size_t k) {
+  typedef typename C::Traits::elem_t Elem;
+  using std::sqrt;
+
+  Elem sigma = Elem(0);
+  for (size_t i = k + 1; i < A.rows(); i++) sigma = sigma + A(i, k) * A(i, k);
+
+  Elem const alpha = A(k, k);
+  if (sigma == Elem(0)) {
+    tau(k) = Elem(0);
+    return;
+  }
+
+  Elem beta = sqrt(alpha * alpha + sigma);
+  if (alpha > Elem(0)) beta = -beta;
+  tau(k) = (beta - alpha) / beta;
+
+  Elem const s = Elem(1) / (alpha - beta);
+  for (size_t i = k + 1; i < A.rows(); i++) A(i, k) = A(i, k) * s;
+  A(k, k) = beta;
+}
+
+/* Forms the upper triangular factor T of the compact WY representation
+ * H(k) ... H(k+kb-1) = I - V T V^T.
+ */
+template <class C, class D>
+constexpr void _qr_block_t(Mapping<C> const &V, Mapping<D> const &tau, size_t k,
+    size_t kb, typename C::Traits::elem_t (&T)[qr_block][qr_block]) {
+  typedef typename C::Traits::elem_t Elem;
+
+  // Inner products of the Householder vectors accumulated along rows
+  Elem G[qr_block][qr_block] = { };
+  for (size_t i = k; i < V.rows(); i++) {
+    Elem v[qr_block] = { };
+    _qr_row(V, i, k, kb, v);
+    for (size_t r = 0; r < kb; r++)
+      for (size_t c = r + 1; c < kb; c++) G[r][c] = G[r][c] + v[r] * v[c];
+  }
+
+  // T(:c, c) = -tau(c) T(:c, :c) V(:, :c)^T v(c)
+  for (size_t c = 0; c < kb; c++) {
+    T[c][c] = tau(k + c);
+    for (size_t r = 0; r < c; r++) {
+      Elem z = Elem(0);
+      for (size_t s = r; s < c; s++) z = z + T[r][s] * G[s][c];
+      T[r][c] = -tau(k + c) * z;
+    }
+  }
+}
+
+/* Applies I - V T V^T, or its transpose, to B(k:, j:j+J) where V holds the
+ * kb Householder vectors starting in column k.
+ */
+template <size_t J, class C, class E>
+constexpr void _qr_apply_cols(Mapping<C> const &V,
+    typename C::Traits::elem_t const (&T)[qr_block][qr_block], size_t k,
+    size_t kb, Mapping<E> &B, size_t j, bool trans) {
+  typedef typename C::Traits::elem_t Elem;
+
+  // W = V^T B
+  Elem W[qr_block][J] = { };
+  for (size_t i = k; i < B.rows(); i++) {
+    Elem v[qr_block] = { }, b[J] = { };
+    _qr_row(V, i, k, kb, v);
+    for (size_t c = 0; c < J; c++) b[c] = B(i, j + c);
+    for (size_t r = 0; r < kb; r++)
+      for (size_t c = 0; c < J; c++) W[r][c] = W[r][c] + v[r] * b[c];
+  }
+
+  // W = T W or W = T^T W
+  if (trans) {
+    for (size_t r = kb; r-- > 0;) {
+      Elem w[J] = { };
+      for (size_t s = 0; s <= r; s++)
+        for (size_t c = 0; c < J; c++) w[c] = w[c] + T[s][r] * W[s][c];
+      for (size_t c = 0; c < J; c++) W[r][c] = w[c];
+    }
+  } else {
+    for (size_t r = 0; r < kb; r++) {
+      Elem w[J] = { };
+      for (size_t s = r; s < kb; s++)
+        for (size_t c = 0; c < J; c++) w[c] = w[c] + T[r][s] * W[s][c];
+      for (size_t c = 0; c < J; c++) W[r][c] = w[c];
+    }
+  }
+
+  // B = B - V W
+  for (size_t i = k; i < B.rows(); i++) {
+    Elem v[qr_block] = { }, b[J] = { };
+    _qr_row(V, i, k, kb, v);
+    for (size_t c = 0; c < J; c++) b[c] = B(i, j + c);
+    for (size_t r = 0; r < kb; r++)
+      for (size_t c = 0; c < J; c++) b[c] = b[c] - v[r] * W[r][c];
+    for (size_t c = 0; c < J; c++) B(i, j + c) = b[c];
+  }
+}
+
+/* Applies I - V T V^T, or its transpose, to B(k:, b:e). Columns are worked
+ * through in fixed size chunks so the inner loops are vectorized.
+ */
+template <class C, class E>
+constexpr void _qr_apply(Mapping<C> const &V,
+    typename C::Traits::elem_t const (&T)[qr_block][qr_block], size_t k,
+    size_t kb, Mapping<E> &B, size_t b, size_t e, bool trans) {
+  size_t j = b;
+  for (; j + _qr_cols <= e; j += _qr_cols) _qr_apply_cols<_qr_cols>(V, T, k, kb, B, j, trans);
+  for (; j < e; j++) _qr_apply_cols<1>(V, T, k, kb, B, j, trans);
+}
+
+}  // namespace internal
 
 template <class C, class D, class E, std::enable_if_t<internal::can_qr<C, D, E>::value, size_t>>
 constexpr int qr(internal::Stream<C> const &M, internal::Mapping<D> &Q, internal::Mapping<E> &R) {
@@ -14,26 +147,52 @@ constexpr int qr(internal::Stream<C> const &M, internal::Mapping<D> &Q, internal
   LIN_ASSERT(M.cols() == R.rows() /* R rows doesn't match in qr(...) */);
   LIN_ASSERT(M.cols() == R.cols() /* R cols doesn't match in qr(...) */);
 
-  // Initialize R and Q
-  R = zeros<E>(R.rows(), R.cols());
+  // Useful traits information
+  typedef typename D::Traits::elem_t Elem;
+  typedef internal::traits_eval_t<internal::VectorStreamReference<
+      D, D::Traits::cols, D::Traits::max_cols>> Tau;
+
+  // Factorize in place and copy out the upper triangle
+  Tau tau(Q.cols());
   Q = M;
+  qr_householder(Q, tau);
 
-  for (size_t j = 0; j < M.cols(); j++) {
-    auto qj = col(Q, j);
+  size_t const n = Q.cols();
+  for (size_t i = 0; i < n; i++)
+    for (size_t j = 0; j < n; j++) R(i, j) = (j < i) ? Elem(0) : Q(i, j);
 
-    // Normalize this column
-    R(j, j) = norm(qj);
-    qj = qj / R(j, j);
+  // Accumulate the thin orthonormal factor in place, block by block, from the
+  // last reflector to the first
+  Elem T[internal::qr_block][internal::qr_block] = { };
+  for (size_t k = (n ? (n - 1) / internal::qr_block * internal::qr_block : 0); n; k -= internal::qr_block) {
+    size_t const kb = (n - k < internal::qr_block) ? n - k : internal::qr_block;
 
-    // Remove parallel components from subsequent columns
-    for (size_t k = j + 1; k < M.cols(); k++) {
-      auto qk = col(Q, k);
-      R(j, k) = dot(qj, qk);
-      qk = qk - qj * R(j, k);
+    if (k + kb < n) {
+      internal::_qr_block_t(Q, tau, k, kb, T);
+      internal::_qr_apply(Q, T, k, kb, Q, k + kb, n, false);
     }
+
+    for (size_t c = k + kb; c-- > k;) {
+      T[0][0] = tau(c);
+      internal::_qr_apply(Q, T, c, 1, Q, c + 1, k + kb, false);
+
+      for (size_t i = 0; i < c; i++) Q(i, c) = Elem(0);
+      Q(c, c) = Elem(1) - tau(c);
+      for (size_t i = c + 1; i < Q.rows(); i++) Q(i, c) = -tau(c) * Q(i, c);
+    }
+
+    if (!k) break;
   }
 
-  return 0;  // TODO : Return an actual status cod
+  // Choose signs such that the diagonal of R is nonnegative
+  for (size_t i = 0; i < n; i++) {
+    if (R(i, i) < Elem(0)) {
+      for (size_t j = i; j < n; j++) R(i, j) = -R(i, j);
+      for (size_t j = 0; j < Q.rows(); j++) Q(j, i) = -Q(j, i);
+    }
+  }
+
+  return 0;
 }
 
 template <class C, class D, class E, std::enable_if_t<internal::can_qr<C, D, E>::value, size_t>>
@@ -42,4 +201,124 @@ constexpr int qr(internal::Stream<C> const &M, internal::Base<D> &Q, internal::B
   R.resize(M.cols(), M.cols());
   return qr(M, static_cast<internal::Mapping<D> &>(Q), static_cast<internal::Mapping<E> &>(R));
 }
+
+template <class C, class D, std::enable_if_t<internal::can_qr_householder<C, D>::value, size_t>>
+constexpr int qr_householder(internal::Mapping<C> &A, internal::Mapping<D> &tau) {
+  LIN_ASSERT(A.rows() >= A.cols() /* A isn't 'tall' in qr_householder(...) */);
+  LIN_ASSERT(A.cols() == tau.rows() /* tau rows doesn't match in qr_householder(...) */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+
+  size_t const n = A.cols();
+  Elem T[internal::qr_block][internal::qr_block] = { };
+  for (size_t k = 0; k < n; k += internal::qr_block) {
+    size_t const kb = (n - k < internal::qr_block) ? n - k : internal::qr_block;
+
+    // Factorize the panel one reflector at a time
+    for (size_t c = k; c < k + kb; c++) {
+      internal::_qr_reflector(A, tau, c);
+      T[0][0] = tau(c);
+      internal::_qr_apply(A, T, c, 1, A, c + 1, k + kb, true);
+    }
+
+    // Apply the whole block to the trailing columns at once
+    if (k + kb < n) {
+      internal::_qr_block_t(A, tau, k, kb, T);
+      internal::_qr_apply(A, T, k, kb, A, k + kb, n, true);
+    }
+  }
+
+  return 0;
+}
+
+template <class C, class D, std::enable_if_t<internal::can_qr_householder<C, D>::value, size_t>>
+constexpr int qr_householder(internal::Mapping<C> &A, internal::Base<D> &tau) {
+  tau.resize(A.cols(), 1);
+  return qr_householder(A, static_cast<internal::Mapping<D> &>(tau));
+}
+
+template <class C, class D, class E, std::enable_if_t<internal::can_qr_apply<C, D, E>::value, size_t>>
+constexpr int qr_apply_q(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X) {
+  LIN_ASSERT(QR.rows() >= QR.cols() /* QR isn't 'tall' in qr_apply_q(...) */);
+  LIN_ASSERT(QR.cols() == tau.rows() /* tau rows doesn't match in qr_apply_q(...) */);
+  LIN_ASSERT(QR.rows() == X.rows() /* X rows doesn't match in qr_apply_q(...) */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+
+  // Q X = H(0) (H(1) ... (H(n-1) X)) so blocks are applied last to first
+  size_t const n = QR.cols();
+  Elem T[internal::qr_block][internal::qr_block] = { };
+  for (size_t k = (n ? (n - 1) / internal::qr_block * internal::qr_block : 0); n; k -= internal::qr_block) {
+    size_t const kb = (n - k < internal::qr_block) ? n - k : internal::qr_block;
+    internal::_qr_block_t(QR, tau, k, kb, T);
+    internal::_qr_apply(QR, T, k, kb, X, 0, X.cols(), false);
+    if (!k) break;
+  }
+
+  return 0;
+}
+
+template <class C, class D, class E, std::enable_if_t<internal::can_qr_apply<C, D, E>::value, size_t>>
+constexpr int qr_apply_qt(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X) {
+  LIN_ASSERT(QR.rows() >= QR.cols() /* QR isn't 'tall' in qr_apply_qt(...) */);
+  LIN_ASSERT(QR.cols() == tau.rows() /* tau rows doesn't match in qr_apply_qt(...) */);
+  LIN_ASSERT(QR.rows() == X.rows() /* X rows doesn't match in qr_apply_qt(...) */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+
+  // Q^T X = H(n-1) (... (H(0) X)) so blocks are applied first to last
+  size_t const n = QR.cols();
+  Elem T[internal::qr_block][internal::qr_block] = { };
+  for (size_t k = 0; k < n; k += internal::qr_block) {
+    size_t const kb = (n - k < internal::qr_block) ? n - k : internal::qr_block;
+    internal::_qr_block_t(QR, tau, k, kb, T);
+    internal::_qr_apply(QR, T, k, kb, X, 0, X.cols(), true);
+  }
+
+  return 0;
+}
+
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_qr_solve<C, D, E, F>::value, size_t>>
+constexpr int qr_solve(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X, internal::Stream<F> const &Y) {
+  LIN_ASSERT(QR.rows() == Y.rows() /* Y rows doesn't match in qr_solve(...) */);
+  LIN_ASSERT(QR.cols() == X.rows() /* X rows doesn't match in qr_solve(...) */);
+  LIN_ASSERT(Y.cols() == X.cols() /* X cols doesn't match in qr_solve(...) */);
+
+  // Useful traits information
+  typedef typename C::Traits::elem_t Elem;
+
+  internal::traits_eval_t<F> Z(Y);
+  qr_apply_qt(QR, tau, Z);
+
+  // Backward substitution with R
+  int status = 0;
+  size_t const n = X.rows();
+  size_t const m = X.cols();
+  for (size_t i = n; i-- > 0;) {
+    for (size_t c = 0; c < m; c++) X(i, c) = Z(i, c);
+    for (size_t p = i + 1; p < n; p++) {
+      Elem const x = QR(i, p);
+      for (size_t c = 0; c < m; c++) X(i, c) = X(i, c) - x * X(p, c);
+    }
+
+    Elem const d = QR(i, i);
+    if (d == Elem(0)) {
+      status = int(i + 1);
+      for (size_t c = 0; c < m; c++) X(i, c) = Elem(0);
+    } else {
+      for (size_t c = 0; c < m; c++) X(i, c) = X(i, c) / d;
+    }
+  }
+
+  return status;
+}
+
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_qr_solve<C, D, E, F>::value, size_t>>
+constexpr int qr_solve(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Base<E> &X, internal::Stream<F> const &Y) {
+  X.resize(QR.cols(), Y.cols());
+  return qr_solve(QR, tau, static_cast<internal::Mapping<E> &>(X), Y);
+}
 }  // namespace lin
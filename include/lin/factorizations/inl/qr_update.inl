@@ -0,0 +1,305 @@
+/** @file lin/factorizations/inl/qr_update.inl
+ *  @author Kyle Krol
+ *  See %lin/factorizations/qr_update.hpp for more information. */
+
+#include "../qr_update.hpp"
+
+namespace lin {
+namespace internal {
+
+/* Computes the Givens rotation taking (a, b) to (r, 0). Both are scaled by the
+ * larger magnitude first so squaring them can't overflow or underflow.
+ */
+template <typename T>
+constexpr void _qr_givens(T const &a, T const &b, T &c, T &s) {
+  using std::abs;
+  using std::sqrt;
+
+  T const m = (abs(a) < abs(b)) ? abs(b) : abs(a);
+  if (m == T(0)) {
+    c = T(1);
+    s = T(0);
+  } else {
+    T const x = a / m, y = b / m;
+    T const r = sqrt(x * x + y * y);
+    c = x / r;
+    s = y / r;
+  }
+}
+
+/* Rotates columns i and j of Q: Q(:, i) = c Q(:, i) + s Q(:, j) and
+ * Q(:, j) = c Q(:, j) - s Q(:, i).
+ */
+template <class D>
+constexpr void _qr_rotate_cols(Mapping<D> &Q, size_t i, size_t j,
+    traits_elem_t<D> const &c, traits_elem_t<D> const &s) {
+  for (size_t r = 0; r < Q.rows(); r++) {
+    traits_elem_t<D> const x = Q(r, i), y = Q(r, j);
+    Q(r, i) = c * x + s * y;
+    Q(r, j) = c * y - s * x;
+  }
+}
+
+/* Rotates rows i and j of R across columns b:e: R(i, :) = c R(i, :) + s R(j, :)
+ * and R(j, :) = c R(j, :) - s R(i, :).
+ */
+template <class E>
+constexpr void _qr_rotate_rows(Mapping<E> &R, size_t i, size_t j, size_t b,
+    size_t e, traits_elem_t<E> const &c, traits_elem_t<E> const &s) {
+  for (size_t k = b; k < e; k++) {
+    traits_elem_t<E> const x = R(i, k), y = R(j, k);
+    R(i, k) = c * x + s * y;
+    R(j, k) = c * y - s * x;
+  }
+}
+
+/* Resizes X keeping its elements in place. Row dr and column dc, if in range,
+ * are dropped and elements past the old dimensions are zeroed. The derived
+ * type is resized so runtime sized tensors are reallocated when they grow.
+ */
+template <class D>
+constexpr void _qr_reshape(Base<D> &X, size_t r, size_t c, size_t dr, size_t dc) {
+  typedef traits_elem_t<D> Elem;
+
+  traits_eval_t<D> const T(X);
+  static_cast<D &>(X).resize(r, c);
+  for (size_t i = 0; i < r; i++) {
+    size_t const y = i + (i >= dr);
+    for (size_t j = 0; j < c; j++) {
+      size_t const x = j + (j >= dc);
+      X(i, j) = (y < T.rows() && x < T.cols()) ? T(y, x) : Elem(0);
+    }
+  }
+}
+
+/* Folds the row w into the upper triangular R with Givens rotations. Each
+ * rotation is passed on to f along with the index of the row of R it mixed
+ * with w.
+ */
+template <class E, class W, class F>
+constexpr void _qr_fold_row(Mapping<E> &R, W &w, F const &f) {
+  typedef traits_elem_t<E> Elem;
+
+  size_t const n = R.rows();
+  for (size_t k = 0; k < n; k++) {
+    Elem c = Elem(1), s = Elem(0);
+    _qr_givens(R(k, k), Elem(w(k)), c, s);
+    for (size_t j = k; j < n; j++) {
+      Elem const x = R(k, j), y = w(j);
+      R(k, j) = c * x + s * y;
+      w(j) = c * y - s * x;
+    }
+    f(k, c, s);
+  }
+}
+
+/* Shifts the columns of R past j left by one and restores the upper
+ * triangular form of the leading columns with Givens rotations. Each rotation
+ * is passed on to f along with the pair of rows it mixed.
+ */
+template <class E, class F>
+constexpr void _qr_drop_col(Mapping<E> &R, size_t j, F const &f) {
+  typedef traits_elem_t<E> Elem;
+
+  size_t const n = R.rows();
+  for (size_t i = 0; i < n; i++)
+    for (size_t k = j; k + 1 < n; k++) R(i, k) = R(i, k + 1);
+
+  for (size_t k = j; k + 1 < n; k++) {
+    Elem c = Elem(1), s = Elem(0);
+    _qr_givens(R(k, k), R(k + 1, k), c, s);
+    _qr_rotate_rows(R, k, k + 1, k, n - 1, c, s);
+    R(k + 1, k) = Elem(0);
+    f(k, c, s);
+  }
+}
+
+}  // namespace internal
+
+template <class D, class E, class F, std::enable_if_t<internal::can_qr_update_vector<D, E, F>::value, size_t>>
+constexpr int qr_append_row(internal::Base<D> &Q, internal::Mapping<E> &R, internal::Stream<F> const &a) {
+  LIN_ASSERT(Q.cols() == R.rows() /* Q cols doesn't match in qr_append_row(...) */);
+  LIN_ASSERT(R.cols() == a.size() /* a size doesn't match in qr_append_row(...) */);
+
+  // Useful traits information
+  typedef typename D::Traits::elem_t Elem;
+  typedef internal::traits_eval_t<internal::VectorStreamReference<
+      D, 0, D::Traits::max_rows>> Column;
+
+  size_t const m = Q.rows();
+  internal::_qr_reshape(Q, m + 1, Q.cols(), size_t(-1), size_t(-1));
+
+  // Q is extended by the column q, starting out as the new unit row, and R
+  // by the row w
+  Column q(m + 1);
+  for (size_t i = 0; i < m; i++) q(i) = Elem(0);
+  q(m) = Elem(1);
+
+  internal::traits_eval_t<F> w(a);
+  internal::_qr_fold_row(R, w, [&](size_t k, Elem const &c, Elem const &s) {
+    for (size_t i = 0; i <= m; i++) {
+      Elem const x = Q(i, k), y = q(i);
+      Q(i, k) = c * x + s * y;
+      q(i) = c * y - s * x;
+    }
+  });
+
+  return 0;
+}
+
+template <class D, class E, std::enable_if_t<internal::can_qr_update<D, E>::value, size_t>>
+constexpr int qr_delete_row(internal::Base<D> &Q, internal::Mapping<E> &R, size_t k) {
+  LIN_ASSERT(Q.cols() == R.rows() /* Q cols doesn't match in qr_delete_row(...) */);
+  LIN_ASSERT(k < Q.rows() /* k out of range in qr_delete_row(...) */);
+  LIN_ASSERT(Q.rows() > Q.cols() /* Q must be tall in qr_delete_row(...) */);
+
+  // Useful traits information
+  typedef typename D::Traits::elem_t Elem;
+  typedef internal::traits_eval_t<internal::VectorStreamReference<
+      D, 0, D::Traits::max_rows>> Column;
+  typedef internal::traits_eval_t<internal::VectorStreamReference<
+      D, 0, D::Traits::max_cols>> Row;
+  using std::sqrt;
+
+  size_t const m = Q.rows();
+  size_t const n = Q.cols();
+
+  // Unit vector u orthogonal to Q such that e_k lies in the span of [Q u],
+  // orthogonalized twice
+  Column u(m);
+  Row t(n);
+  for (size_t i = 0; i < m; i++) u(i) = Elem(i == k);
+  for (size_t pass = 0; pass < 2; pass++) {
+    for (size_t j = 0; j < n; j++) t(j) = Elem(0);
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) t(j) = t(j) + Q(i, j) * u(i);
+    for (size_t i = 0; i < m; i++) {
+      Elem x = u(i);
+      for (size_t j = 0; j < n; j++) x = x - Q(i, j) * t(j);
+      u(i) = x;
+    }
+  }
+
+  Elem g = Elem(0);
+  for (size_t i = 0; i < m; i++) g = g + u(i) * u(i);
+  g = sqrt(g);
+  if (g == Elem(0)) return int(k + 1);
+  for (size_t i = 0; i < m; i++) u(i) = u(i) / g;
+
+  // Rotate row k of Q into u, carrying the extra row w of R along. Working
+  // from the last column keeps R upper triangular.
+  Row w(n);
+  for (size_t j = 0; j < n; j++) w(j) = Elem(0);
+  for (size_t j = n; j-- > 0;) {
+    Elem c = Elem(1), s = Elem(0);
+    internal::_qr_givens(u(k), Q(k, j), c, s);
+    for (size_t i = 0; i < m; i++) {
+      Elem const x = Q(i, j), y = u(i);
+      Q(i, j) = c * x - s * y;
+      u(i) = s * x + c * y;
+    }
+    for (size_t i = j; i < n; i++) {
+      Elem const x = R(j, i), y = w(i);
+      R(j, i) = c * x - s * y;
+      w(i) = s * x + c * y;
+    }
+  }
+
+  internal::_qr_reshape(Q, m - 1, n, k, size_t(-1));
+  return 0;
+}
+
+template <class D, class E, class F, std::enable_if_t<internal::can_qr_update_vector<D, E, F>::value, size_t>>
+constexpr int qr_append_col(internal::Base<D> &Q, internal::Base<E> &R, internal::Stream<F> const &a) {
+  LIN_ASSERT(Q.cols() == R.rows() /* Q cols doesn't match in qr_append_col(...) */);
+  LIN_ASSERT(Q.rows() == a.size() /* a size doesn't match in qr_append_col(...) */);
+  LIN_ASSERT(Q.rows() > Q.cols() /* Q must stay tall in qr_append_col(...) */);
+
+  // Useful traits information
+  typedef typename D::Traits::elem_t Elem;
+  using std::sqrt;
+
+  size_t const m = Q.rows();
+  size_t const n = Q.cols();
+  internal::_qr_reshape(Q, m, n + 1, size_t(-1), size_t(-1));
+  internal::_qr_reshape(R, n + 1, n + 1, size_t(-1), size_t(-1));
+
+  // Orthogonalize the new column of Q against the others twice. The new row
+  // of R holds the projections in between.
+  for (size_t i = 0; i < m; i++) Q(i, n) = a(i);
+  for (size_t pass = 0; pass < 2; pass++) {
+    for (size_t j = 0; j < n; j++) R(n, j) = Elem(0);
+    for (size_t i = 0; i < m; i++)
+      for (size_t j = 0; j < n; j++) R(n, j) = R(n, j) + Q(i, j) * Q(i, n);
+    for (size_t i = 0; i < m; i++) {
+      Elem x = Q(i, n);
+      for (size_t j = 0; j < n; j++) x = x - Q(i, j) * R(n, j);
+      Q(i, n) = x;
+    }
+    for (size_t j = 0; j < n; j++) R(j, n) = R(j, n) + R(n, j);
+  }
+  for (size_t j = 0; j < n; j++) R(n, j) = Elem(0);
+
+  Elem r = Elem(0);
+  for (size_t i = 0; i < m; i++) r = r + Q(i, n) * Q(i, n);
+  r = sqrt(r);
+  R(n, n) = r;
+  for (size_t i = 0; i < m; i++) Q(i, n) = (r == Elem(0)) ? Elem(0) : Q(i, n) / r;
+
+  return (r == Elem(0)) ? int(n + 1) : 0;
+}
+
+template <class D, class E, std::enable_if_t<internal::can_qr_update<D, E>::value, size_t>>
+constexpr int qr_delete_col(internal::Base<D> &Q, internal::Base<E> &R, size_t j) {
+  LIN_ASSERT(Q.cols() == R.rows() /* Q cols doesn't match in qr_delete_col(...) */);
+  LIN_ASSERT(j < R.cols() /* j out of range in qr_delete_col(...) */);
+
+  // Useful traits information
+  typedef typename D::Traits::elem_t Elem;
+
+  size_t const n = R.rows();
+  internal::_qr_drop_col(R, j, [&](size_t k, Elem const &c, Elem const &s) {
+    internal::_qr_rotate_cols(Q, k, k + 1, c, s);
+  });
+
+  internal::_qr_reshape(Q, Q.rows(), n - 1, size_t(-1), size_t(-1));
+  internal::_qr_reshape(R, n - 1, n - 1, size_t(-1), size_t(-1));
+  return 0;
+}
+
+template <class E, class F, std::enable_if_t<internal::can_qr_update_r_vector<E, F>::value, size_t>>
+constexpr int qr_append_row(internal::Mapping<E> &R, internal::Stream<F> const &a) {
+  LIN_ASSERT(R.rows() == R.cols() /* R must be square */);
+  LIN_ASSERT(R.cols() == a.size() /* a size doesn't match in qr_append_row(...) */);
+
+  // Useful traits information
+  typedef typename E::Traits::elem_t Elem;
+
+  internal::traits_eval_t<F> w(a);
+  internal::_qr_fold_row(R, w, [](size_t, Elem const &, Elem const &) { });
+  return 0;
+}
+
+template <class E, class F, std::enable_if_t<internal::can_qr_update_r_vector<E, F>::value, size_t>>
+constexpr int qr_delete_row(internal::Mapping<E> &R, internal::Stream<F> const &a) {
+  LIN_ASSERT(R.rows() == R.cols() /* R must be square */);
+  LIN_ASSERT(R.cols() == a.size() /* a size doesn't match in qr_delete_row(...) */);
+
+  internal::MappingTranspose<E> L(R);
+  return internal::_chol_rotate(L, a, -1);
+}
+
+template <class E, std::enable_if_t<internal::can_qr_update_r<E>::value, size_t>>
+constexpr int qr_delete_col(internal::Base<E> &R, size_t j) {
+  LIN_ASSERT(R.rows() == R.cols() /* R must be square */);
+  LIN_ASSERT(j < R.cols() /* j out of range in qr_delete_col(...) */);
+
+  // Useful traits information
+  typedef typename E::Traits::elem_t Elem;
+
+  size_t const n = R.rows();
+  internal::_qr_drop_col(R, j, [](size_t, Elem const &, Elem const &) { });
+  internal::_qr_reshape(R, n - 1, n - 1, size_t(-1), size_t(-1));
+  return 0;
+}
+}  // namespace lin
@@ -0,0 +1,102 @@
+/** @file lin/factorizations/ldlt.hpp
+ *  @author Kyle Krol
+ *  Defines a square root free LDL^T factorization algorithm for tensor types. */
+
+#ifndef LIN_FACTORIZATIONS_LDLT_HPP_
+#define LIN_FACTORIZATIONS_LDLT_HPP_
+
+#include "../core.hpp"
+#include "../substitutions.hpp"
+
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @struct can_ldlt
+ *  Symmetric types are excluded as the factorization uses the upper triangle
+ *  as scratch. */
+template <class C>
+struct can_ldlt : conjunction<is_matrix<C>, is_square<C>, negation<is_symmetric<C>>> { };
+
+/** @struct can_ldlt_solve
+ *  Used to test whether or not the provided types can be fed to the LDL^T
+ *  solve. */
+template <class C, class D, class E>
+struct can_ldlt_solve : conjunction<
+    can_ldlt<C>, can_multiply<C, D>, have_same_elements<C, D, E>,
+    have_same_dimensions<D, E>
+  > { };
+
+}  // namespace internal
+
+/** @brief Computes the LDL^T factorization of a symmetric, positive semi
+ *         definite matrix in place.
+ *
+ *  @tparam C Matrix type.
+ *
+ *  @param L Matrix to factorize and the resulting compact factorization.
+ *
+ *  @return Zero on success and, if a pivot is negative, its index plus one.
+ *
+ *  Only the lower triangle of the input is read. On return the strictly lower
+ *  triangle holds the unit lower triangular factor `L`, the diagonal holds the
+ *  diagonal factor `D`, and the upper triangle is zeroed.
+ *
+ *  Unlike chol, no square roots are taken and zero pivots are allowed. Pivots
+ *  within \f$n \epsilon \max_i |A_{ii}|\f$ of zero are treated as zero: they're
+ *  set to zero along with the column of `L` below them so semi definite
+ *  matrices, such as rank deficient covariances, can be factorized. If a pivot
+ *  is any more negative, the factorization stops and the matrix is left
+ *  partially factorized. Pivots are only checked for element types that can
+ *  be compared with zero. As no pivoting is done, rounding errors grow when
+ *  the leading pivots are small relative to the largest.
+ *
+ *  @sa ldlt_solve
+ */
+template <class C, std::enable_if_t<internal::can_ldlt<C>::value, size_t> = 0>
+constexpr int ldlt(internal::Mapping<C> &L);
+
+/** @brief Solves a linear system using an LDL^T factorization.
+ *
+ *  @tparam C Matrix type.
+ *  @tparam D Unknown matrix or vector type.
+ *  @tparam E Known matrix or vector type.
+ *
+ *  @param LD Compact factorization computed by ldlt.
+ *  @param X  Unknown matrix or vector.
+ *  @param Y  Known matrix or vector.
+ *
+ *  @return Zero on success and, if a pivot is zero, its index plus one.
+ *
+ *  Solves \f$L D L^T X = Y\f$ with a forward substitution through the unit
+ *  lower triangle, a diagonal scale, and a backward substitution through the
+ *  transpose of the unit lower triangle. The transpose is never formed.
+ *
+ *  Components of the solution along a zero pivot are set to zero. As ldlt
+ *  stores pivots within its tolerance as exact zeros, only those are checked.
+ *
+ *  Lin assertion errors will be thrown if the dimensions of `X` are not the
+ *  same as the dimensions of `Y`.
+ *
+ *  @sa ldlt
+ */
+template <class C, class D, class E, std::enable_if_t<internal::can_ldlt_solve<C, D, E>::value, size_t> = 0>
+constexpr int ldlt_solve(internal::Mapping<C> const &LD, internal::Mapping<D> &X, internal::Stream<E> const &Y);
+
+/** @brief Solves a linear system using an LDL^T factorization.
+ *
+ *  Resizes `X` to match `Y` before solving.
+ *
+ *  @sa ldlt
+ */
+template <class C, class D, class E, std::enable_if_t<internal::can_ldlt_solve<C, D, E>::value, size_t> = 0>
+constexpr int ldlt_solve(internal::Mapping<C> const &LD, internal::Base<D> &X, internal::Stream<E> const &Y);
+
+}  // namespace lin
+
+#include "inl/ldlt.inl"
+
+#endif
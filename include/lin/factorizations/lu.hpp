@@ -0,0 +1,117 @@
+/** @file lin/factorizations/lu.hpp
+ *  @author Kyle Krol
+ *  Defines an LU factorization algorithm with partial pivoting for tensor
+ *  types. */
+
+#ifndef LIN_FACTORIZATIONS_LU_HPP_
+#define LIN_FACTORIZATIONS_LU_HPP_
+
+#include "../core.hpp"
+#include "../substitutions.hpp"
+
+#include <cmath>
+#include <type_traits>
+#include <utility>
+
+namespace lin {
+namespace internal {
+
+/** @struct can_lu
+ *  Used to test whether or not the provided types can be fed to the LU
+ *  factorization algorithm. The permutation must be a column vector of
+ *  integral row indices and the factors can't be stored in a symmetric type. */
+template <class C, class D>
+struct can_lu : conjunction<
+    is_matrix<C>, is_square<C>, negation<is_symmetric<C>>, is_col_vector<D>,
+    std::is_integral<traits_elem_t<D>>
+  > { };
+
+/** @struct can_lu_solve
+ *  Used to test whether or not the provided types can be fed to the LU solve.
+ */
+template <class C, class D, class E, class F>
+struct can_lu_solve : conjunction<
+    can_lu<C, D>, can_multiply<C, E>, have_same_elements<C, E, F>,
+    have_same_dimensions<E, F>
+  > { };
+
+}  // namespace internal
+
+/** @brief Computes the LU factorization of a square matrix in place with
+ *         partial pivoting.
+ *
+ *  @tparam C Matrix type.
+ *  @tparam D Integral column vector type.
+ *
+ *  @param A Matrix to factorize and the resulting compact factorization.
+ *  @param P Resulting row interchanges.
+ *
+ *  @return Zero on success and, if a pivot is zero, its index plus one.
+ *
+ *  Factorizes \f$P A = L U\f$. On return the strictly lower triangle of `A`
+ *  holds the unit lower triangular factor `L` and the upper triangle holds
+ *  `U`. The permutation is stored compactly: row `k` was interchanged with
+ *  row `P(k)` at step `k`, as in LAPACK.
+ *
+ *  At each step the element of largest magnitude in the column is chosen as
+ *  the pivot and the trailing submatrix is updated one contiguous row at a
+ *  time. A zero pivot means the matrix is singular; the factorization
+ *  continues past it and the first such index plus one is returned.
+ *
+ *  @sa lu_solve
+ */
+template <class C, class D, std::enable_if_t<internal::can_lu<C, D>::value, size_t> = 0>
+constexpr int lu(internal::Mapping<C> &A, internal::Mapping<D> &P);
+
+/** @brief Computes the LU factorization of a square matrix in place with
+ *         partial pivoting.
+ *
+ *  Resizes `P` to match the rows of `A` before factorizing.
+ *
+ *  @sa lu
+ */
+template <class C, class D, std::enable_if_t<internal::can_lu<C, D>::value, size_t> = 0>
+constexpr int lu(internal::Mapping<C> &A, internal::Base<D> &P);
+
+/** @brief Solves a linear system using an LU factorization.
+ *
+ *  @tparam C Matrix type.
+ *  @tparam D Integral column vector type.
+ *  @tparam E Unknown matrix or vector type.
+ *  @tparam F Known matrix or vector type.
+ *
+ *  @param LU Compact factorization computed by lu.
+ *  @param P  Row interchanges computed by lu.
+ *  @param X  Unknown matrix or vector.
+ *  @param Y  Known matrix or vector.
+ *
+ *  @return Zero on success and, if a pivot is zero, its index plus one.
+ *
+ *  Solves \f$A X = Y\f$ for any number of right hand sides by interchanging
+ *  the rows of `Y`, substituting forward through the unit lower triangle, and
+ *  then backward through `U` with backward_sub. If a pivot is zero, `X` is left
+ *  unsolved.
+ *
+ *  Lin assertion errors will be thrown if the dimensions of `X` are not the
+ *  same as the dimensions of `Y`.
+ *
+ *  @sa lu
+ *  @sa backward_sub
+ */
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_lu_solve<C, D, E, F>::value, size_t> = 0>
+constexpr int lu_solve(internal::Mapping<C> const &LU, internal::Mapping<D> const &P, internal::Mapping<E> &X, internal::Stream<F> const &Y);
+
+/** @brief Solves a linear system using an LU factorization.
+ *
+ *  Resizes `X` to match `Y` before solving.
+ *
+ *  @sa lu_solve
+ */
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_lu_solve<C, D, E, F>::value, size_t> = 0>
+constexpr int lu_solve(internal::Mapping<C> const &LU, internal::Mapping<D> const &P, internal::Base<E> &X, internal::Stream<F> const &Y);
+
+}  // namespace lin
+
+#include "inl/lu.inl"
+
+#endif
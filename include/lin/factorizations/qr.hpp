@@ -1,8 +1,6 @@
 /** @file lin/factorizations/qr.hpp
  *  @author Kyle Krol
- *  Defines a QR factorization algorithm for tensor types. */
-
-// TODO : Documentation for this entire fil
+ *  Defines QR factorization algorithms for tensor types. */
 
 #ifndef LIN_FACTORIZATIONS_QR_HPP_
 #define LIN_FACTORIZATIONS_QR_HPP_
@@ -11,6 +9,7 @@
 #include "../generators/constants.hpp"
 #include "../references.hpp"
 
+#include <cmath>
 #include <type_traits>
 
 namespace lin {
@@ -28,16 +27,104 @@ struct can_qr : conjunction<
     have_same_dimensions<C, D>
   > { };
 
+/** @struct can_qr_householder
+ *  Used to test whether or not the provided types can be fed to the
+ *  Householder QR factorization algorithm. */
+template <class C, class D>
+struct can_qr_householder : conjunction<
+    is_matrix<C>, is_tall<C>, negation<is_symmetric<C>>, is_col_vector<D>,
+    have_same_elements<C, D>
+  > { };
+
+/** @struct can_qr_apply
+ *  Used to test whether or not the provided types can be fed to the functions
+ *  applying the orthogonal factor of a Householder QR factorization. */
+template <class C, class D, class E>
+struct can_qr_apply : conjunction<
+    can_qr_householder<C, D>, have_same_elements<C, E>
+  > { };
+
+/** @struct can_qr_solve
+ *  Used to test whether or not the provided types can be fed to the
+ *  Householder QR least squares solve. */
+template <class C, class D, class E, class F>
+struct can_qr_solve : conjunction<
+    can_qr_apply<C, D, F>, have_same_elements<C, E>
+  > { };
+
+/** @brief Number of reflectors the Householder QR factorization groups into
+ *         each compact WY block.
+ */
+constexpr size_t qr_block = 16;
+
 }  // namespace internal
 
-/** @fn qr */
+/** @brief Computes the thin QR factorization of a tall matrix.
+ *
+ *  @return Zero.
+ *
+ *  `Q` is accumulated from the reflectors of qr_householder and the diagonal
+ *  of `R` is nonnegative.
+ */
 template <class C, class D, class E, std::enable_if_t<internal::can_qr<C, D, E>::value, size_t> = 0>
 constexpr int qr(internal::Stream<C> const &M, internal::Mapping<D> &Q, internal::Mapping<E> &R);
 
-/** @fn qr */
+/** @brief Computes the thin QR factorization of a tall matrix, resizing `Q`
+ *         and `R` to match `M`.
+ */
 template <class C, class D, class E, std::enable_if_t<internal::can_qr<C, D, E>::value, size_t> = 0>
 constexpr int qr(internal::Stream<C> const &M, internal::Base<D> &Q, internal::Base<E> &R);
 
+/** @brief Computes the QR factorization of a tall matrix in place with
+ *         Householder reflections.
+ *
+ *  @return Zero.
+ *
+ *  `R` is left in the upper triangle and the Householder vectors, with an
+ *  implied leading one, below it. Reflectors are applied `internal::qr_block`
+ *  at a time in compact WY form.
+ */
+template <class C, class D, std::enable_if_t<internal::can_qr_householder<C, D>::value, size_t> = 0>
+constexpr int qr_householder(internal::Mapping<C> &A, internal::Mapping<D> &tau);
+
+/** @brief Computes the QR factorization of a tall matrix in place with
+ *         Householder reflections, resizing `tau` to match the columns of `A`.
+ */
+template <class C, class D, std::enable_if_t<internal::can_qr_householder<C, D>::value, size_t> = 0>
+constexpr int qr_householder(internal::Mapping<C> &A, internal::Base<D> &tau);
+
+/** @brief Multiplies `X` in place by the orthogonal factor of qr_householder.
+ *
+ *  @return Zero.
+ */
+template <class C, class D, class E, std::enable_if_t<internal::can_qr_apply<C, D, E>::value, size_t> = 0>
+constexpr int qr_apply_q(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X);
+
+/** @brief Multiplies `X` in place by the transpose of the orthogonal factor
+ *         of qr_householder.
+ *
+ *  @return Zero.
+ */
+template <class C, class D, class E, std::enable_if_t<internal::can_qr_apply<C, D, E>::value, size_t> = 0>
+constexpr int qr_apply_qt(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X);
+
+/** @brief Solves the least squares problem \f$\min \|A X - Y\|\f$ using the
+ *         factorization of qr_householder.
+ *
+ *  @return Zero on success and, if a diagonal element of `R` is zero, its
+ *          index plus one.
+ *
+ *  Components of the solution along a zero diagonal element are set to zero.
+ */
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_qr_solve<C, D, E, F>::value, size_t> = 0>
+constexpr int qr_solve(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Mapping<E> &X, internal::Stream<F> const &Y);
+
+/** @brief Solves the least squares problem \f$\min \|A X - Y\|\f$, resizing
+ *         `X` to match.
+ */
+template <class C, class D, class E, class F, std::enable_if_t<internal::can_qr_solve<C, D, E, F>::value, size_t> = 0>
+constexpr int qr_solve(internal::Mapping<C> const &QR, internal::Mapping<D> const &tau, internal::Base<E> &X, internal::Stream<F> const &Y);
+
 }  // namespace lin
 
 #include "inl/qr.inl"
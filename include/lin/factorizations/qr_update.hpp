@@ -0,0 +1,209 @@
+/** @file lin/factorizations/qr_update.hpp
+ *  @author Kyle Krol
+ *  Defines updates of QR factorizations as rows and columns are appended and
+ *  deleted. */
+
+#ifndef LIN_FACTORIZATIONS_QR_UPDATE_HPP_
+#define LIN_FACTORIZATIONS_QR_UPDATE_HPP_
+
+#include "../core.hpp"
+#include "chol.hpp"
+
+#include <cmath>
+#include <type_traits>
+
+namespace lin {
+namespace internal {
+
+/** @struct can_qr_update
+ *  Used to test whether or not the provided types can be fed to the QR
+ *  updates. */
+template <class D, class E>
+struct can_qr_update : conjunction<
+    is_matrix<D>, is_square<E>, have_same_elements<D, E>
+  > { };
+
+/** @struct can_qr_update_vector
+ *  Used to test whether or not the provided types can be fed to the QR
+ *  updates appending a row or column. */
+template <class D, class E, class F>
+struct can_qr_update_vector : conjunction<
+    can_qr_update<D, E>, is_vector<F>, have_same_elements<E, F>
+  > { };
+
+/** @struct can_qr_update_r
+ *  Used to test whether or not the provided types can be fed to the QR
+ *  updates of a lone triangular factor. */
+template <class E>
+struct can_qr_update_r : conjunction<is_matrix<E>, is_square<E>> { };
+
+/** @struct can_qr_update_r_vector
+ *  Used to test whether or not the provided types can be fed to the QR
+ *  updates of a lone triangular factor appending or deleting a row. */
+template <class E, class F>
+struct can_qr_update_r_vector : conjunction<
+    can_qr_update_r<E>, is_vector<F>, have_same_elements<E, F>
+  > { };
+
+}  // namespace internal
+
+/** @brief Updates a thin QR factorization to account for a row appended to
+ *         the factorized matrix.
+ *
+ *  @tparam D Orthonormal factor type.
+ *  @tparam E Upper triangular factor type.
+ *  @tparam F Vector type.
+ *
+ *  @param Q Matrix with orthonormal columns, grows by a row.
+ *  @param R Upper triangular factor.
+ *  @param a Row appended to the factorized matrix.
+ *
+ *  @return Zero.
+ *
+ *  Folds the new row into `R` with one Givens rotation per column in
+ *  \f$O(m n)\f$, rather than refactorizing in \f$O(m n^2)\f$.
+ *
+ *  @sa qr
+ *  @sa qr_delete_row
+ */
+template <class D, class E, class F, std::enable_if_t<internal::can_qr_update_vector<D, E, F>::value, size_t> = 0>
+constexpr int qr_append_row(internal::Base<D> &Q, internal::Mapping<E> &R, internal::Stream<F> const &a);
+
+/** @brief Updates a thin QR factorization to account for a row deleted from
+ *         the factorized matrix.
+ *
+ *  @tparam D Orthonormal factor type.
+ *  @tparam E Upper triangular factor type.
+ *
+ *  @param Q Matrix with orthonormal columns and more rows than columns,
+ *           shrinks by a row.
+ *  @param R Upper triangular factor.
+ *  @param k Index of the deleted row.
+ *
+ *  @return Zero on success and, if the remaining rows no longer have full
+ *          rank, the index of the deleted row plus one.
+ *
+ *  The orthonormal factor is extended by a column so its row `k` has unit
+ *  length and Givens rotations then turn that row into the new column, which
+ *  is dropped along with the row. Costs \f$O(m n)\f$.
+ *
+ *  No such column exists if the unit vector along row `k` lies in the span of
+ *  `Q`'s columns exactly. The remaining rows then don't have full rank and
+ *  `Q` and `R` are left unchanged.
+ *
+ *  @sa qr
+ *  @sa qr_append_row
+ */
+template <class D, class E, std::enable_if_t<internal::can_qr_update<D, E>::value, size_t> = 0>
+constexpr int qr_delete_row(internal::Base<D> &Q, internal::Mapping<E> &R, size_t k);
+
+/** @brief Updates a thin QR factorization to account for a column appended to
+ *         the factorized matrix.
+ *
+ *  @tparam D Orthonormal factor type.
+ *  @tparam E Upper triangular factor type.
+ *  @tparam F Vector type.
+ *
+ *  @param Q Matrix with orthonormal columns, grows by a column.
+ *  @param R Upper triangular factor, grows by a row and column.
+ *  @param a Column appended to the factorized matrix.
+ *
+ *  @return Zero on success and, if the new column's residual is exactly zero,
+ *          the new column count.
+ *
+ *  The new column is orthogonalized against `Q` with one step of
+ *  reorthogonalization in \f$O(m n)\f$. If its residual is exactly zero, the
+ *  new column of `Q` and diagonal element of `R` are zero. Columns that are
+ *  only numerically dependent leave a diagonal element of `R` on the order of
+ *  rounding error instead.
+ *
+ *  @sa qr
+ *  @sa qr_delete_col
+ */
+template <class D, class E, class F, std::enable_if_t<internal::can_qr_update_vector<D, E, F>::value, size_t> = 0>
+constexpr int qr_append_col(internal::Base<D> &Q, internal::Base<E> &R, internal::Stream<F> const &a);
+
+/** @brief Updates a thin QR factorization to account for a column deleted
+ *         from the factorized matrix.
+ *
+ *  @tparam D Orthonormal factor type.
+ *  @tparam E Upper triangular factor type.
+ *
+ *  @param Q Matrix with orthonormal columns, shrinks by a column.
+ *  @param R Upper triangular factor, shrinks by a row and column.
+ *  @param j Index of the deleted column.
+ *
+ *  @return Zero.
+ *
+ *  Removing the column leaves `R` upper Hessenberg from column `j` on. Givens
+ *  rotations restore its triangular form in \f$O(m n)\f$.
+ *
+ *  @sa qr
+ *  @sa qr_append_col
+ */
+template <class D, class E, std::enable_if_t<internal::can_qr_update<D, E>::value, size_t> = 0>
+constexpr int qr_delete_col(internal::Base<D> &Q, internal::Base<E> &R, size_t j);
+
+/** @brief Updates the triangular factor of a QR factorization to account for
+ *         a row appended to the factorized matrix.
+ *
+ *  @tparam E Upper triangular factor type.
+ *  @tparam F Vector type.
+ *
+ *  @param R Upper triangular factor.
+ *  @param a Row appended to the factorized matrix.
+ *
+ *  @return Zero.
+ *
+ *  The orthogonal factor isn't needed; Givens rotations fold the new row into
+ *  `R` in \f$O(n^2)\f$. For a least squares problem, append the right hand
+ *  side as a last column of the factorized matrix and the last column of `R`
+ *  carries the transformed right hand side along.
+ *
+ *  @sa qr_delete_row
+ */
+template <class E, class F, std::enable_if_t<internal::can_qr_update_r_vector<E, F>::value, size_t> = 0>
+constexpr int qr_append_row(internal::Mapping<E> &R, internal::Stream<F> const &a);
+
+/** @brief Updates the triangular factor of a QR factorization to account for
+ *         a row deleted from the factorized matrix.
+ *
+ *  @tparam E Upper triangular factor type.
+ *  @tparam F Vector type.
+ *
+ *  @param R Upper triangular factor with a positive diagonal.
+ *  @param a Row deleted from the factorized matrix.
+ *
+ *  @return Zero on success and, if the remaining rows no longer have full
+ *          rank, the index of the first pivot that isn't positive plus one.
+ *
+ *  As \f$R^T R = A^T A\f$, this is the Cholesky downdate of \f$R^T\f$ and is
+ *  computed in \f$O(n^2)\f$ with hyperbolic rotations by chol_downdate's
+ *  kernel. If it fails, `R` is left partially updated.
+ *
+ *  @sa qr_append_row
+ *  @sa chol_downdate
+ */
+template <class E, class F, std::enable_if_t<internal::can_qr_update_r_vector<E, F>::value, size_t> = 0>
+constexpr int qr_delete_row(internal::Mapping<E> &R, internal::Stream<F> const &a);
+
+/** @brief Updates the triangular factor of a QR factorization to account for
+ *         a column deleted from the factorized matrix.
+ *
+ *  @tparam E Upper triangular factor type.
+ *
+ *  @param R Upper triangular factor, shrinks by a row and column.
+ *  @param j Index of the deleted column.
+ *
+ *  @return Zero.
+ *
+ *  @sa qr_delete_col
+ */
+template <class E, std::enable_if_t<internal::can_qr_update_r<E>::value, size_t> = 0>
+constexpr int qr_delete_col(internal::Base<E> &R, size_t j);
+
+}  // namespace lin
+
+#include "inl/qr_update.inl"
+
+#endif
@@ -9,6 +9,9 @@
 
 #include "../core.hpp"
 
+#include <algorithm>
+#include <type_traits>
+
 namespace lin {
 namespace internal {
 
@@ -100,6 +103,76 @@ class StreamConstants : public Stream<StreamConstants<T, R, C, MR, MC>>,
 
     return t;
   }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written, which, in this case, never happens.
+   *
+   *  @return False.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &, bool) const {
+    return false;
+  }
+
+  /** @brief Retrieves a packet of tensor elements, which, in this case all
+   *         hold a specified constant.
+   *
+   *  @tparam N Number of lanes.
+   *
+   *  @return Packet whose lanes all equal the constant.
+   *
+   *  The offset of the first element is ignored so packets may be read with
+   *  any stride.
+   */
+  template <size_t N>
+  constexpr Packet<typename Traits::elem_t, N> packet(size_t) const {
+    return packet_broadcast<N>(t);
+  }
+
+  /** @brief Fills a mapping with the constant.
+   *
+   *  @tparam E Destination type.
+   *
+   *  @param m Destination.
+   *
+   *  Value backed destinations are filled as a single run of their backing
+   *  array, which compilers lower to `memset` for zeros. Padding, if any, is
+   *  filled along the way. Other destinations are filled element by element in
+   *  the order of their layout, only on and below the diagonal if symmetric.
+   *
+   *  If the dimensions of the mapping don't match the stream's, lin assertion
+   *  errors will be triggered.
+   *
+   *  @sa internal::Mapping::operator=(Stream<C> const &)
+   */
+  template <class E>
+  constexpr void eval_to(Mapping<E> &m) const {
+    LIN_ASSERT(m.rows() == rows());
+    LIN_ASSERT(m.cols() == cols());
+
+    fill(m, is_value_backed<E>());
+  }
+
+ private:
+  template <class E>
+  constexpr void fill(Mapping<E> &m, std::true_type) const {
+    size_t const n = traits<E>::stride
+        ? (is_col_major<E>::value ? cols() : rows()) * traits<E>::stride : size();
+    std::fill_n(static_cast<E &>(m).data(), n, t);
+  }
+
+  template <class E>
+  constexpr void fill(Mapping<E> &m, std::false_type) const {
+    if (is_col_major<E>::value) {
+      for (size_t j = 0; j < cols(); j++)
+        for (size_t i = 0; i < rows(); i++) m(i, j) = t;
+    }
+    else {
+      for (size_t i = 0; i < rows(); i++)
+        for (size_t j = 0; j < (is_symmetric<E>::value ? i + 1 : cols()); j++) m(i, j) = t;
+    }
+  }
 };
 
 template <typename T, size_t R, size_t C, size_t MR, size_t MC>
@@ -114,6 +187,16 @@ struct _dims<StreamConstants<T, R, C, MR, MC>> {
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
+
+template <typename T, size_t R, size_t C, size_t MR, size_t MC>
+struct _linear<StreamConstants<T, R, C, MR, MC>> : std::true_type { };
+
+template <typename T, size_t R, size_t C, size_t MR, size_t MC>
+struct _packet<StreamConstants<T, R, C, MR, MC>> : std::true_type {
+  static constexpr size_t stride = packet_any_stride;
+  typedef void layout;
+};
+
 }  // namespace internal
 }  // namespace lin
 
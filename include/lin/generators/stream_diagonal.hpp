@@ -129,6 +129,19 @@ class StreamDiagonal : public Stream<StreamDiagonal<E>> {
 
     return (*this)(i / cols(), i % cols());
   }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r Region about to be written.
+   *
+   *  @return True if the underlying vector stream overlaps the region.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool) const {
+    return _stream.aliases(r, false);
+  }
 };
 
 template <class E>
@@ -96,6 +96,17 @@ class StreamIdentity : public Stream<StreamIdentity<T, R, C, MR, MC>>,
 
     return (*this)(i / cols(), i % cols());
   }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written, which, in this case, never happens.
+   *
+   *  @return False.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &, bool) const {
+    return false;
+  }
 };
 
 template <typename T, size_t R, size_t C, size_t MR, size_t MC>
@@ -0,0 +1,106 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+//
+// MIT License
+//
+// Copyright (c) 2020 kylekrol
+// Copyright (c) 2020 Pathfinder for Autonomous Navigation (PAN)
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+/** @file lin/parallel.hpp
+ *  @author Kyle Krol
+ */
+
+/** @defgroup PARALLEL Parallel
+ *
+ *  @brief Opt in multithreaded evaluation of large tensor expressions.
+ *
+ *  Assignments are evaluated on the calling thread by default. Wrapping the
+ *  destination of an assignment with lin::parallel splits large, element by
+ *  element assignments across a pool of worker threads:
+ *
+ *  ~~~{.cpp}
+ *  #include <lin/core.hpp>
+ *  #include <lin/math.hpp>
+ *  #include <lin/parallel.hpp>
+ *
+ *  lin::Matrix<double, 512, 512> A, B, C;
+ *  // ...
+ *  lin::parallel(C) = lin::exp(A) + 2.0 * B;
+ *  lin::parallel(C) = A * B;
+ *  ~~~
+ *
+ *  Large matrix products are additionally cache blocked. Results are bitwise
+ *  identical to serial evaluation. The pool is created on first use with
+ *  `LIN_PARALLEL_THREADS` threads. Assignments with fewer than
+ *  `LIN_PARALLEL_MIN_SIZE` elements, and products with fewer than
+ *  `LIN_PARALLEL_GEMM_MIN_SIZE` multiply adds, are evaluated serially.
+ */
+
+#ifndef LIN_PARALLEL_HPP_
+#define LIN_PARALLEL_HPP_
+
+#include "core.hpp"
+#include "parallel/gemm.hpp"
+#include "parallel/mapping_parallel.hpp"
+#include "parallel/thread_pool.hpp"
+
+namespace lin {
+
+/** @brief Marks the destination of an assignment for parallel evaluation.
+ *
+ *  @tparam C Destination type.
+ *
+ *  @param c Destination.
+ *
+ *  @return Instance of an internal::MappingParallel.
+ *
+ *  @sa internal::MappingParallel
+ *
+ *  @ingroup PARALLEL
+ */
+template <class C, std::enable_if_t<
+    internal::matches_tensor<C>::value, size_t> = 0>
+constexpr auto parallel(internal::Mapping<C> &c) {
+  return internal::MappingParallel<C>(c);
+}
+
+/** @brief Marks the destination of an assignment for parallel evaluation.
+ *
+ *  @tparam C Destination type.
+ *
+ *  @param c Destination.
+ *
+ *  @return Instance of an internal::MappingParallel.
+ *
+ *  Allows references, such as lin::ref, to be assigned to in parallel.
+ *
+ *  @sa internal::MappingParallel
+ *
+ *  @ingroup PARALLEL
+ */
+template <class C, std::enable_if_t<
+    internal::matches_tensor<C>::value, size_t> = 0>
+constexpr auto parallel(internal::Mapping<C> &&c) {
+  return internal::MappingParallel<C>(c);
+}
+}  // namespace lin
+
+#endif
@@ -0,0 +1,236 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/parallel/gemm.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_PARALLEL_GEMM_HPP_
+#define LIN_PARALLEL_GEMM_HPP_
+
+#include "../core.hpp"
+#include "thread_pool.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/** @def LIN_PARALLEL_GEMM_MIN_SIZE
+ *  @brief Smallest number of multiply adds a parallel matrix product is cache
+ *         blocked and split across threads for.
+ *
+ *  Smaller products are evaluated serially with internal::gemm. Can be
+ *  overridden by defining the `LIN_PARALLEL_GEMM_MIN_SIZE` macro when
+ *  building.
+ *
+ *  @ingroup PARALLEL
+ */
+
+#ifndef LIN_PARALLEL_GEMM_MIN_SIZE
+  #define LIN_PARALLEL_GEMM_MIN_SIZE 262144
+#endif
+
+namespace lin {
+namespace internal {
+
+/** @brief Rows of the left operand reused across every micro panel of the
+ *         right operand.
+ *
+ *  Sized so a block of the left operand stays in L2 cache.
+ *
+ *  @sa internal::gemm_parallel
+ *
+ *  @ingroup PARALLEL
+ */
+constexpr size_t gemm_panel_rows = 64;
+
+/** @brief Depth of the inner dimension accumulated per packed panel.
+ *
+ *  Sized so a micro panel of the right operand stays in L1 cache.
+ *
+ *  @sa internal::gemm_parallel
+ *
+ *  @ingroup PARALLEL
+ */
+constexpr size_t gemm_panel_depth = 256;
+
+/** @brief Columns of the right operand packed into a panel at once.
+ *
+ *  Sized so the packed panel, shared by all threads, stays in L3 cache.
+ *
+ *  @sa internal::gemm_parallel
+ *
+ *  @ingroup PARALLEL
+ */
+constexpr size_t gemm_panel_cols = 512;
+
+/** @brief Operand of a parallel matrix product held in row major memory.
+ *
+ *  @tparam C %Tensor type.
+ *
+ *  Behaves like internal::PackedStream except operands that must be evaluated
+ *  are evaluated into a heap allocated temporary. Products large enough to be
+ *  split across threads easily have operands too large for the stack.
+ *
+ *  @sa internal::gemm_parallel
+ *
+ *  @ingroup PARALLEL
+ */
+template <class C, typename = void>
+class HeapPackedStream {
+ private:
+  /** @brief Evaluated operand.
+   */
+  std::unique_ptr<traits_eval_t<C> const> const c;
+
+ public:
+  /** @brief Evaluates a stream into contiguous memory.
+   *
+   *  @param s %Tensor stream.
+   */
+  HeapPackedStream(Stream<C> const &s)
+  : c(new traits_eval_t<C>(s)) { }
+
+  /** @return Pointer to the first element of the operand.
+   */
+  traits_elem_t<C> const *data() const {
+    return c->data();
+  }
+
+  /** @return Leading dimension of the operand.
+   */
+  size_t stride() const {
+    return c->stride();
+  }
+};
+
+template <class C>
+class HeapPackedStream<C, std::enable_if_t<conjunction<
+    is_value_backed<C>, negation<is_col_major<C>>>::value>> : public PackedStream<C> {
+ public:
+  using PackedStream<C>::PackedStream;
+};
+
+/** @brief Matrix multiplication driver splitting large products across the
+ *         threads of the thread pool.
+ *
+ *  Products with fewer than `LIN_PARALLEL_GEMM_MIN_SIZE` multiply adds are
+ *  evaluated serially with internal::gemm. Larger ones are cache blocked:
+ *
+ *   - The right operand is packed, `gemm_panel_depth` rows by
+ *     `gemm_panel_cols` columns at a time, into contiguous micro panels one
+ *     kernel block wide. The panel is packed once and shared by all threads.
+ *   - Each thread owns a contiguous range of the result's rows and sweeps
+ *     `gemm_panel_rows` of them at a time across every micro panel.
+ *   - Accumulators are carried between panels along the inner dimension in
+ *     the element type of the product.
+ *
+ *  Every element is accumulated in order of increasing `k`, with the same
+ *  kernel, exactly as internal::gemm would. Results are therefore bitwise
+ *  identical to a serial evaluation.
+ *
+ *  Symmetric results only have the lower triangle computed and stored, so no
+ *  two threads ever write the same element.
+ *
+ *  Operands that aren't value backed are packed into heap allocated
+ *  temporaries with internal::HeapPackedStream.
+ *
+ *  @sa internal::gemm
+ *  @sa internal::StreamMultiply::eval_to
+ *
+ *  @ingroup PARALLEL
+ */
+struct gemm_parallel {
+  template <class C>
+  using packed_t = HeapPackedStream<C>;
+
+  template <typename R, typename T, typename U, class E, class F>
+  void run(size_t m, size_t n, size_t k, T const *a, size_t lda, U const *b,
+      size_t ldb, Mapping<E> &x, F const &f) const {
+    constexpr size_t MR = gemm_block_rows;
+    constexpr size_t NR = gemm_block_cols<R>::value;
+    constexpr size_t MC = gemm_panel_rows - gemm_panel_rows % MR;
+    constexpr size_t KC = gemm_panel_depth;
+    constexpr size_t NC = gemm_panel_cols - gemm_panel_cols % NR;
+    constexpr bool lower = is_symmetric<E>::value;
+
+    // Full kernel blocks along each dimension
+    size_t const mb = m / MR;
+    size_t const nb = n / NR;
+    if (m * n * k < LIN_PARALLEL_GEMM_MIN_SIZE || !mb || !nb) {
+      gemm<R>(m, n, k, a, lda, b, ldb, x, f);
+      return;
+    }
+
+    ThreadPool &pool = thread_pool();
+    size_t const tasks = (pool.size() < mb) ? pool.size() : mb;
+
+    std::vector<U> panel(NC * ((k < KC) ? k : KC));
+    std::vector<R> partial((k > KC) ? mb * MR * NC : 0);
+
+    for (size_t jc = 0; jc < nb * NR; jc += NC) {
+      size_t const nc = (nb * NR - jc < NC) ? nb * NR - jc : NC;
+      size_t const qs = nc / NR;
+
+      for (size_t pc = 0; pc < k; pc += KC) {
+        size_t const kc = (k - pc < KC) ? k - pc : KC;
+        bool const first = (pc == 0);
+        bool const last = (pc + kc == k);
+
+        // Micro panel q holds kc rows of NR contiguous elements
+        size_t const packers = (tasks < qs) ? tasks : qs;
+        pool.run(packers, [&](size_t t) {
+          for (size_t q = t * qs / packers; q < (t + 1) * qs / packers; q++) {
+            U *const p = panel.data() + q * kc * NR;
+            for (size_t l = 0; l < kc; l++)
+              for (size_t c = 0; c < NR; c++) p[l * NR + c] = b[(pc + l) * ldb + jc + q * NR + c];
+          }
+        });
+
+        pool.run(tasks, [&](size_t t) {
+          size_t const ib = (t * mb / tasks) * MR;
+          size_t const ie = ((t + 1) * mb / tasks) * MR;
+          for (size_t ic = ib; ic < ie; ic += MC) {
+            size_t const ice = (ie - ic < MC) ? ie : ic + MC;
+            for (size_t q = 0; q < qs; q++) {
+              size_t const j = jc + q * NR;
+              if (lower && j >= ice) break;
+              for (size_t i = ic; i < ice; i += MR) {
+                if (lower && j >= i + MR) continue;
+                R acc[MR][NR];
+                for (size_t r = 0; r < MR; r++)
+                  for (size_t c = 0; c < NR; c++)
+                    acc[r][c] = first ? R(0) : partial[(i + r) * NC + q * NR + c];
+
+                gemm_block(kc, a + i * lda + pc, lda, panel.data() + q * kc * NR, NR, acc);
+
+                for (size_t r = 0; r < MR; r++) {
+                  for (size_t c = 0; c < NR; c++) {
+                    if (!last) partial[(i + r) * NC + q * NR + c] = acc[r][c];
+                    else if (!lower || j + c <= i + r) x(i + r, j + c) = f(i + r, j + c, acc[r][c]);
+                  }
+                }
+              }
+            }
+          }
+        });
+      }
+    }
+
+    // Elements along the bottom and right edges are individual dot products
+    pool.run(tasks, [&](size_t t) {
+      size_t const ib = (t * mb / tasks) * MR;
+      size_t const ie = (t + 1 == tasks) ? m : ((t + 1) * mb / tasks) * MR;
+      for (size_t i = ib; i < ie; i++) {
+        for (size_t j = (i < mb * MR) ? nb * NR : 0; j < n && (!lower || j <= i); j++) {
+          R acc = R(0);
+          for (size_t p = 0; p < k; p++) acc = fmadd(a[i * lda + p], b[p * ldb + j], acc);
+          x(i, j) = f(i, j, acc);
+        }
+      }
+    });
+  }
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -0,0 +1,160 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/parallel/mapping_parallel.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_PARALLEL_MAPPING_PARALLEL_HPP_
+#define LIN_PARALLEL_MAPPING_PARALLEL_HPP_
+
+#include "../core.hpp"
+#include "gemm.hpp"
+#include "thread_pool.hpp"
+
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+/** @def LIN_PARALLEL_MIN_SIZE
+ *  @brief Smallest number of elements a parallel assignment is split across
+ *         threads for.
+ *
+ *  Smaller assignments are evaluated serially on the calling thread as the
+ *  cost of waking the workers would outweigh any gains. Can be overridden by
+ *  defining the `LIN_PARALLEL_MIN_SIZE` macro when building.
+ *
+ *  @ingroup PARALLEL
+ */
+
+#ifndef LIN_PARALLEL_MIN_SIZE
+  #define LIN_PARALLEL_MIN_SIZE 16384
+#endif
+
+namespace lin {
+namespace internal {
+
+/** @brief Proxy assigning to a mapping across the threads of the thread pool.
+ *
+ *  @tparam D Destination type.
+ *
+ *  Element by element assignments with at least `LIN_PARALLEL_MIN_SIZE`
+ *  elements are split into contiguous ranges of rows, or columns if column
+ *  major, or of packets for densely stored tensors. Each range is evaluated
+ *  on its own thread with exactly the same code a serial assignment would use
+ *  so results are bitwise identical.
+ *
+ *  Matrix products are evaluated with the cache blocked internal::gemm_parallel
+ *  driver.
+ *
+ *  Everything else is evaluated serially on the calling thread. That includes
+ *  other streams evaluating themselves all at once, such as affine products,
+ *  and streams reading elements of the destination at other positions, which
+ *  are first evaluated into a heap allocated temporary.
+ *
+ *  @sa parallel
+ *  @sa internal::gemm_parallel
+ *  @sa internal::ThreadPool
+ *  @sa LIN_PARALLEL_MIN_SIZE
+ *
+ *  @ingroup PARALLEL
+ */
+template <class D>
+class MappingParallel {
+ private:
+  template <typename T, typename U>
+  using assign_expr = decltype(std::declval<T &>() = std::declval<U &>());
+
+  template <class C>
+  using gemm_expr = decltype(std::declval<C const &>().eval_to(
+      std::declval<Mapping<D> &>(), std::declval<gemm_parallel const &>()));
+
+  /** @brief Destination.
+   */
+  Mapping<D> &m;
+
+  /* Large tensors easily outgrow the stack so the temporary is allocated on
+   * the heap instead.
+   */
+  template <class C>
+  inline void assign_evaluated(Stream<C> const &s) {
+    std::unique_ptr<traits_eval_t<C> const> const t(new traits_eval_t<C>(s));
+    m.assign(*t);
+  }
+
+  template <class C, class S>
+  inline void assign(Stream<C> const &s, std::true_type, S) {
+    static_cast<C const &>(s).eval_to(m, gemm_parallel());
+  }
+
+  template <class C>
+  inline void assign(Stream<C> const &s, std::false_type, std::true_type) {
+    m.assign(s);
+  }
+
+  template <class C>
+  inline void assign(Stream<C> const &s, std::false_type, std::false_type) {
+    typedef typename Mapping<D>::template assign_with_packets<C> P;
+
+    size_t const units = m.template assign_units<C>();
+    size_t const grain = Mapping<D>::template assign_grain<C>();
+    size_t const grains = (units + grain - 1) / grain;
+
+    ThreadPool &pool = thread_pool();
+    size_t const n = (pool.size() < grains) ? pool.size() : grains;
+    if (m.size() < LIN_PARALLEL_MIN_SIZE || n < 2) {
+      m.assign(s, 0, units, P());
+      return;
+    }
+
+    // Task t covers grains [t * grains / n, (t + 1) * grains / n)
+    pool.run(n, [&](size_t t) {
+      size_t const b = (t * grains / n) * grain;
+      size_t const e = ((t + 1) * grains / n) * grain;
+      m.assign(s, b, (e < units) ? e : units, P());
+    });
+  }
+
+ public:
+  constexpr MappingParallel() = delete;
+  constexpr MappingParallel(MappingParallel<D> const &) = default;
+  constexpr MappingParallel(MappingParallel<D> &&) = default;
+
+  /** @brief Constructs a proxy to the destination of an assignment.
+   *
+   *  @param m Destination.
+   */
+  constexpr MappingParallel(Mapping<D> &m)
+  : m(m) { }
+
+  /** @brief Copies a stream's elements into the destination.
+   *
+   *  @param s Other tensor stream.
+   *
+   *  @return Reference to the destination.
+   *
+   *  Behaves just like internal::Mapping::operator=(Stream<C> const &) except
+   *  large, element by element assignments and matrix products are split
+   *  across threads.
+   */
+  template <class C, std::enable_if_t<conjunction<
+      have_same_dimensions<D, C>,
+      is_detected<assign_expr, traits_elem_t<D>, traits_elem_t<C>>
+    >::value, size_t> = 0>
+  D &operator=(Stream<C> const &s) {
+    typedef typename Mapping<D>::template assign_with_eval_to<C> E;
+    typedef typename Mapping<D>::template assign_unrolled<C> U;
+
+    LIN_ASSERT(m.rows() == s.rows());
+    LIN_ASSERT(m.cols() == s.cols());
+
+    if (s.aliases(m.region(), true))
+      assign_evaluated(s);
+    else
+      assign(s, conjunction<negation<U>, is_detected<gemm_expr, C>>(), disjunction<E, U>());
+    return m.derived();
+  }
+};
+}  // namespace internal
+}  // namespace lin
+
+#endif
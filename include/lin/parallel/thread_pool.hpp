@@ -0,0 +1,168 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+/** @file lin/parallel/thread_pool.hpp
+ *  @author Kyle Krol
+ */
+
+#ifndef LIN_PARALLEL_THREAD_POOL_HPP_
+#define LIN_PARALLEL_THREAD_POOL_HPP_
+
+#include "../core.hpp"
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** @def LIN_PARALLEL_THREADS
+ *  @brief Number of threads, including the calling thread, parallel
+ *         evaluations are split across.
+ *
+ *  Defaults to zero which selects `std::thread::hardware_concurrency()`. Can be
+ *  overridden by defining the `LIN_PARALLEL_THREADS` macro when building.
+ *
+ *  @ingroup PARALLEL
+ */
+
+#ifndef LIN_PARALLEL_THREADS
+  #define LIN_PARALLEL_THREADS 0
+#endif
+
+namespace lin {
+namespace internal {
+
+/** @brief Fixed size pool of worker threads.
+ *
+ *  Runs a number of independent tasks across the workers and the calling
+ *  thread and returns once all of them are complete. Only one set of tasks
+ *  runs at a time; concurrent callers wait their turn. Tasks that themselves
+ *  run tasks on the pool have them executed inline on their own thread.
+ *
+ *  @sa internal::MappingParallel
+ *
+ *  @ingroup PARALLEL
+ */
+class ThreadPool {
+ private:
+  std::vector<std::thread> workers;
+
+  std::mutex run_mutex;
+  std::mutex mutex;
+  std::condition_variable wake;
+  std::condition_variable done;
+
+  std::function<void(size_t)> const *task;
+  size_t tasks;
+  size_t next;
+  size_t remaining;
+  size_t generation;
+  bool stop;
+
+  /* Whether the current thread is executing a task from any pool.
+   */
+  static inline bool &in_task() {
+    static thread_local bool flag = false;
+    return flag;
+  }
+
+  /* Executes tasks from the current set until none are left to claim. Must be
+   * called with the lock held.
+   */
+  inline void drain(std::unique_lock<std::mutex> &lock) {
+    while (next < tasks) {
+      size_t const t = next++;
+      lock.unlock();
+      in_task() = true;
+      (*task)(t);
+      in_task() = false;
+      lock.lock();
+      if (--remaining == 0) done.notify_all();
+    }
+  }
+
+  inline void work() {
+    size_t seen = 0;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+      wake.wait(lock, [&] { return stop || generation != seen; });
+      if (stop) return;
+      seen = generation;
+      drain(lock);
+    }
+  }
+
+ public:
+  ThreadPool() = delete;
+  ThreadPool(ThreadPool const &) = delete;
+  ThreadPool(ThreadPool &&) = delete;
+  ThreadPool &operator=(ThreadPool const &) = delete;
+  ThreadPool &operator=(ThreadPool &&) = delete;
+
+  /** @brief Starts the worker threads.
+   *
+   *  @param threads Number of threads tasks run on including the caller's.
+   */
+  explicit ThreadPool(size_t threads)
+  : task(nullptr), tasks(0), next(0), remaining(0), generation(0), stop(false) {
+    for (size_t i = 1; i < threads; i++) workers.emplace_back([this] { work(); });
+  }
+
+  /** @brief Stops and joins the worker threads.
+   */
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    wake.notify_all();
+    for (std::thread &worker : workers) worker.join();
+  }
+
+  /** @return Number of threads tasks run on including the caller's.
+   */
+  inline size_t size() const {
+    return workers.size() + 1;
+  }
+
+  /** @brief Runs a set of tasks to completion.
+   *
+   *  @param n Number of tasks.
+   *  @param f Task function called once with each index in `[0, n)`.
+   */
+  inline void run(size_t n, std::function<void(size_t)> const &f) {
+    if (in_task() || workers.empty() || n < 2) {
+      for (size_t t = 0; t < n; t++) f(t);
+      return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(run_mutex);
+    std::unique_lock<std::mutex> lock(mutex);
+    task = &f;
+    tasks = n;
+    next = 0;
+    remaining = n;
+    generation++;
+    wake.notify_all();
+
+    drain(lock);
+    done.wait(lock, [&] { return remaining == 0; });
+    task = nullptr;
+  }
+};
+
+/** @brief Thread pool parallel evaluations run on.
+ *
+ *  Created on first use with `LIN_PARALLEL_THREADS` threads.
+ *
+ *  @ingroup PARALLEL
+ */
+inline ThreadPool &thread_pool() {
+  static ThreadPool pool(LIN_PARALLEL_THREADS ? size_t(LIN_PARALLEL_THREADS)
+      : (std::thread::hardware_concurrency() ? std::thread::hardware_concurrency() : 1));
+  return pool;
+}
+}  // namespace internal
+}  // namespace lin
+
+#endif
@@ -133,6 +133,14 @@ class DiagonalMappingReference : public Mapping<DiagonalMappingReference<E>> {
 
     return _mapping(i, i);
   }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    return _mapping.region().diagonal();
+  }
 };
 
 template <class E>
@@ -147,6 +155,9 @@ struct _dims<DiagonalMappingReference<E>> {
   constexpr static size_t max_rows = E::Traits::max_rows;
   constexpr static size_t max_cols = 1;
 };
+
+template <class E>
+struct _linear<DiagonalMappingReference<E>> : std::true_type { };
 }  // namespace internal
 }  // namespace lin
 
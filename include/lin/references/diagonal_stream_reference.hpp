@@ -131,6 +131,42 @@ class DiagonalStreamReference : public Stream<DiagonalStreamReference<E>> {
 
     return _stream(i, i);
   }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  Only available if the underlying stream is value backed or a reference to
+   *  one.
+   *
+   *  @sa internal::Region
+   */
+  template <class F = E, std::enable_if_t<has_region<F>::value, size_t> = 0>
+  inline Region region() const {
+    return static_cast<F const &>(_stream).region().diagonal();
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if evaluating the reference may read an overwritten element.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return aliases(r, positional, has_region<E>());
+  }
+
+ private:
+  inline bool aliases(Region const &r, bool positional, std::true_type) const {
+    return region_aliases(region(), r, positional);
+  }
+
+  inline bool aliases(Region const &r, bool, std::false_type) const {
+    return _stream.aliases(r, false);
+  }
 };
 
 template <class E>
@@ -145,6 +181,12 @@ struct _dims<DiagonalStreamReference<E>> {
   constexpr static size_t max_rows = E::Traits::max_rows;
   constexpr static size_t max_cols = 1;
 };
+
+template <class E>
+struct _linear<DiagonalStreamReference<E>> : std::true_type { };
+
+template <class E>
+struct _lazy_product<DiagonalStreamReference<E>> : has_lazy_product<E> { };
 }  // namespace internal
 }  // namespace lin
 
@@ -77,6 +77,9 @@ struct _dims<MatrixMappingReference<E, R, C, MR, MC>> {
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
+
+template <class E, size_t R, size_t C, size_t MR, size_t MC>
+struct _layout<MatrixMappingReference<E, R, C, MR, MC>> : _layout<E> { };
 }  // namespace internal
 }  // namespace lin
 
@@ -77,6 +77,12 @@ struct _dims<MatrixStreamReference<E, R, C, MR, MC>> {
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
+
+template <class E, size_t R, size_t C, size_t MR, size_t MC>
+struct _layout<MatrixStreamReference<E, R, C, MR, MC>> : _layout<E> { };
+
+template <class E, size_t R, size_t C, size_t MR, size_t MC>
+struct _lazy_product<MatrixStreamReference<E, R, C, MR, MC>> : has_lazy_product<E> { };
 }  // namespace internal
 }  // namespace lin
 
@@ -152,14 +152,27 @@ class TensorMappingReference : public Mapping<D>, public Dimensions<D> {
    *  Element access proceeds as if all the elements of the tensor stream were
    *  flattened into an array in row major order.
    *
+   *  References to vectors index the underlying tensor directly without a
+   *  division.
+   *
    *  If the index is out of bounds as defined by the tensor's current size, lin
    *  assertion errors will be triggered.
    */
   constexpr typename Traits::elem_t &operator()(size_t i) {
     LIN_ASSERT((i >= 0) && (i < size()));
 
+    if (is_col_vector<D>::value) return operator()(i, 0);
+    if (is_row_vector<D>::value) return operator()(0, i);
     return operator()(i / cols(), i % cols());
   }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  @sa internal::Region
+   */
+  inline Region region() const {
+    return _mapping.region().block(_i, _j, rows(), cols());
+  }
 };
 }  // namespace internal
 }  // namespace lin
@@ -155,6 +155,9 @@ class TensorStreamReference : public Stream<D>, public Dimensions<D> {
    *  Element access proceeds as if all the elements of the tensor stream were
    *  flattened into an array in row major order.
    *
+   *  References to vectors index the underlying tensor directly without a
+   *  division.
+   *
    *  If the index is out of bounds as defined by the tensor's current size, lin
    *  assertion errors will be triggered.
    *
@@ -166,8 +169,49 @@ class TensorStreamReference : public Stream<D>, public Dimensions<D> {
   constexpr typename Traits::elem_t operator()(size_t i) const {
     LIN_ASSERT((i >= 0) && (i < size()));
 
+    if (is_col_vector<D>::value) return operator()(i, 0);
+    if (is_row_vector<D>::value) return operator()(0, i);
     return operator()(i / cols(), i % cols());
   }
+
+  /** @return Region of memory holding the tensor's elements.
+   *
+   *  Only available if the underlying stream is value backed or a reference to
+   *  one.
+   *
+   *  @sa internal::Region
+   */
+  template <class F = E, std::enable_if_t<has_region<F>::value, size_t> = 0>
+  inline Region region() const {
+    return static_cast<F const &>(_stream).region().block(_i, _j, rows(), cols());
+  }
+
+  /** @brief Tests if evaluating this stream reads memory that's about to be
+   *         written.
+   *
+   *  @param r          Region about to be written.
+   *  @param positional Whether elements are read and written at the same
+   *                    position.
+   *
+   *  @return True if evaluating the reference may read an overwritten element.
+   *
+   *  References into expressions read the expression at shifted positions so
+   *  `positional` is cleared when forwarding the check.
+   *
+   *  @sa internal::Stream::aliases
+   */
+  inline bool aliases(Region const &r, bool positional) const {
+    return aliases(r, positional, has_region<E>());
+  }
+
+ private:
+  inline bool aliases(Region const &r, bool positional, std::true_type) const {
+    return region_aliases(region(), r, positional);
+  }
+
+  inline bool aliases(Region const &r, bool, std::false_type) const {
+    return _stream.aliases(r, false);
+  }
 };
 }  // namespace internal
 }  // namespace lin
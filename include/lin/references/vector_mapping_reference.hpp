@@ -108,6 +108,9 @@ struct _dims<VectorMappingReference<E, N, MN>> {
   static constexpr size_t max_cols = 1;
 };
 
+template <class E, size_t N, size_t MN>
+struct _linear<VectorMappingReference<E, N, MN>> : std::true_type { };
+
 /** @brief Generic row vector reference with read and write access.
  *
  *  @tparam E  Underlying referenced type.
@@ -202,6 +205,9 @@ struct _dims<RowVectorMappingReference<E, N, MN>> {
   static constexpr size_t max_rows = 1;
   static constexpr size_t max_cols = MN;
 };
+
+template <class E, size_t N, size_t MN>
+struct _linear<RowVectorMappingReference<E, N, MN>> : std::true_type { };
 }  // namespace internal
 }  // namespace lin
 
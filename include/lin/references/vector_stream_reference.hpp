@@ -108,6 +108,12 @@ struct _dims<VectorStreamReference<E, N, MN>> {
   static constexpr size_t max_cols = 1;
 };
 
+template <class E, size_t N, size_t MN>
+struct _linear<VectorStreamReference<E, N, MN>> : std::true_type { };
+
+template <class E, size_t N, size_t MN>
+struct _lazy_product<VectorStreamReference<E, N, MN>> : has_lazy_product<E> { };
+
 /** @brief Generic row vector reference with read only access.
  *
  *  @tparam E  Underlying referenced type.
@@ -202,6 +208,12 @@ struct _dims<RowVectorStreamReference<E, N, MN>> {
   static constexpr size_t max_rows = 1;
   static constexpr size_t max_cols = MN;
 };
+
+template <class E, size_t N, size_t MN>
+struct _linear<RowVectorStreamReference<E, N, MN>> : std::true_type { };
+
+template <class E, size_t N, size_t MN>
+struct _lazy_product<RowVectorStreamReference<E, N, MN>> : has_lazy_product<E> { };
 }  // namespace internal
 }  // namespace lin
 
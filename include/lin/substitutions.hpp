@@ -41,7 +41,10 @@
 #include "core.hpp"
 #include "references.hpp"
 
+#include <initializer_list>
 #include <type_traits>
+#include <utility>
+
 
 namespace lin {
 namespace internal {
@@ -77,6 +80,231 @@ struct can_backward_sub : conjunction<
 template <class C, class D, class E>
 struct can_forward_sub : can_backward_sub<C, D, E> {};
 
+/** @internal
+ *
+ *  @brief Rows of the unknowns solved for per diagonal block of a
+ *         substitution.
+ *
+ *  Rows above, or below, a block are eliminated from it all at once with a
+ *  register blocked kernel before the block itself is solved for.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+constexpr size_t substitution_block = 32;
+
+/** @internal
+ *
+ *  @brief Reads the elements of a triangular operator as is.
+ *
+ *  @tparam C Triangular operator type.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C>
+struct substitution_normal {
+  Mapping<C> const &t;
+
+  constexpr traits_elem_t<C> operator()(size_t i, size_t j) const {
+    return t(i, j);
+  }
+};
+
+/** @internal
+ *
+ *  @brief Reads the elements of a triangular operator's transpose without
+ *         forming it.
+ *
+ *  @tparam C Triangular operator type.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C>
+struct substitution_transposed {
+  Mapping<C> const &t;
+
+  constexpr traits_elem_t<C> operator()(size_t i, size_t j) const {
+    return t(j, i);
+  }
+};
+
+template <typename T>
+using _zero_expr = decltype(bool(std::declval<T const &>() == T(0)));
+
+/* Whether a diagonal element is zero. Element types that can't be compared,
+ * such as batch lanes, are assumed not to be.
+ */
+template <typename T>
+constexpr bool _substitution_zero(T const &d, std::true_type) {
+  return d == T(0);
+}
+
+template <typename T>
+constexpr bool _substitution_zero(T const &, std::false_type) {
+  return false;
+}
+
+/* Subtracts x * X(p, b:e) from X(i, b:e). Works through fixed size chunks so
+ * the subtraction is vectorized.
+ */
+template <size_t N, class D>
+constexpr void _substitution_axpy(Mapping<D> &X, size_t i, size_t p, size_t b,
+    size_t e, traits_elem_t<D> const &x) {
+  typedef traits_elem_t<D> Elem;
+
+  size_t j = b;
+  for (; j + N <= e; j += N) {
+    Elem y[N] = { };
+    for (size_t c = 0; c < N; c++) y[c] = X(p, j + c);
+    for (size_t c = 0; c < N; c++) y[c] = X(i, j + c) - x * y[c];
+    for (size_t c = 0; c < N; c++) X(i, j + c) = y[c];
+  }
+  for (; j < e; j++) X(i, j) = X(i, j) - x * X(p, j);
+}
+
+/* Divides X(i, :) by d.
+ */
+template <size_t N, class D>
+constexpr void _substitution_scale(Mapping<D> &X, size_t i,
+    traits_elem_t<D> const &d) {
+  typedef traits_elem_t<D> Elem;
+
+  size_t j = 0;
+  for (; j + N <= X.cols(); j += N) {
+    Elem y[N] = { };
+    for (size_t c = 0; c < N; c++) y[c] = X(i, j + c) / d;
+    for (size_t c = 0; c < N; c++) X(i, j + c) = y[c];
+  }
+  for (; j < X.cols(); j++) X(i, j) = X(i, j) / d;
+}
+
+/* Accumulates x * y into a row of accumulators.
+ */
+template <size_t NR, typename T>
+constexpr void _substitution_row(T const &x, T const (&y)[NR], T (&acc)[NR]) {
+  for (size_t c = 0; c < NR; c++) acc[c] = fmadd(x, y[c], acc[c]);
+}
+
+/* Subtracts T(i:i+MR, b:e) X(b:e, j:j+NR) from X(i:i+MR, j:j+NR). Rows are
+ * unrolled so the accumulators stay in registers.
+ */
+template <size_t NR, class A, class D, size_t... R>
+constexpr void _substitution_update(A const &t, Mapping<D> &X, size_t i,
+    size_t j, size_t b, size_t e, std::index_sequence<R...>) {
+  typedef traits_elem_t<D> Elem;
+
+  Elem acc[sizeof...(R)][NR] = { };
+  for (size_t p = b; p < e; p++) {
+    Elem y[NR] = { };
+    for (size_t c = 0; c < NR; c++) y[c] = X(p, j + c);
+    (void) std::initializer_list<int>{ (_substitution_row<NR>(t(i + R, p), y, acc[R]), 0)... };
+  }
+  for (size_t r = 0; r < sizeof...(R); r++)
+    for (size_t c = 0; c < NR; c++) X(i + r, j + c) = X(i + r, j + c) - acc[r][c];
+}
+
+/* Eliminates the already solved rows X(b:e, :) from X(k:kn, :).
+ */
+template <class A, class D>
+constexpr void _substitution_eliminate(A const &t, Mapping<D> &X, size_t k,
+    size_t kn, size_t b, size_t e) {
+  constexpr size_t MR = gemm_block_rows;
+  constexpr size_t NR = gemm_block_cols<traits_elem_t<D>>::value;
+  size_t const m = X.cols();
+
+  size_t i = k;
+  for (; i + MR <= kn; i += MR) {
+    size_t j = 0;
+    for (; j + NR <= m; j += NR)
+      _substitution_update<NR>(t, X, i, j, b, e, std::make_index_sequence<MR>());
+    for (size_t r = 0; r < MR; r++)
+      for (size_t p = b; p < e; p++) _substitution_axpy<NR>(X, i + r, p, j, m, t(i + r, p));
+  }
+  for (; i < kn; i++)
+    for (size_t p = b; p < e; p++) _substitution_axpy<NR>(X, i, p, 0, m, t(i, p));
+}
+
+/** @internal
+ *
+ *  @brief Solves a lower triangular system in place.
+ *
+ *  @param t    Accessor to the lower triangular operator.
+ *  @param X    Known matrix or vector overwritten with the solution.
+ *  @param unit Whether the operator's diagonal is implied to be all ones.
+ *
+ *  Works down through blocks of `substitution_block` rows. The rows solved for
+ *  so far are eliminated from each block with a register blocked kernel and
+ *  the block is then solved one row at a time. Every update is a contiguous
+ *  row operation across all right hand sides for row major unknowns.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class A, class D>
+constexpr void substitution_lower(A const &t, Mapping<D> &X, bool unit) {
+  constexpr size_t NB = substitution_block;
+  constexpr size_t NR = gemm_block_cols<traits_elem_t<D>>::value;
+  size_t const n = X.rows();
+
+  for (size_t k = 0; k < n; k += NB) {
+    size_t const kn = (n - k < NB) ? n : k + NB;
+
+    _substitution_eliminate(t, X, k, kn, 0, k);
+    for (size_t i = k; i < kn; i++) {
+      for (size_t p = k; p < i; p++) _substitution_axpy<NR>(X, i, p, 0, X.cols(), t(i, p));
+      if (!unit) _substitution_scale<NR>(X, i, t(i, i));
+    }
+  }
+}
+
+/** @internal
+ *
+ *  @brief Solves an upper triangular system in place.
+ *
+ *  @param t    Accessor to the upper triangular operator.
+ *  @param X    Known matrix or vector overwritten with the solution.
+ *  @param unit Whether the operator's diagonal is implied to be all ones.
+ *
+ *  Works up through blocks of `substitution_block` rows just as
+ *  internal::substitution_lower works down through them.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class A, class D>
+constexpr void substitution_upper(A const &t, Mapping<D> &X, bool unit) {
+  constexpr size_t NB = substitution_block;
+  constexpr size_t NR = gemm_block_cols<traits_elem_t<D>>::value;
+  size_t const n = X.rows();
+
+  for (size_t k = (n ? (n - 1) / NB * NB : 0); n; k -= NB) {
+    size_t const kn = (n - k < NB) ? n : k + NB;
+
+    _substitution_eliminate(t, X, k, kn, kn, n);
+    for (size_t i = kn; i-- > k;) {
+      for (size_t p = i + 1; p < kn; p++) _substitution_axpy<NR>(X, i, p, 0, X.cols(), t(i, p));
+      if (!unit) _substitution_scale<NR>(X, i, t(i, i));
+    }
+
+    if (!k) break;
+  }
+}
+
+/** @internal
+ *
+ *  @brief Finds the first zero on the diagonal of a triangular operator.
+ *
+ *  @return Zero if there is none and its index plus one otherwise.
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C>
+constexpr size_t substitution_singular(Mapping<C> const &T) {
+  typedef traits_elem_t<C> Elem;
+  typedef is_detected<_zero_expr, Elem> Comparable;
+
+  for (size_t i = 0; i < T.rows(); i++)
+    if (_substitution_zero(T(i, i), Comparable())) return i + 1;
+  return 0;
+}
+
 } // namespace internal
 
 /** @brief Solves a linear system using backward substitution.
@@ -89,7 +317,8 @@ struct can_forward_sub : can_backward_sub<C, D, E> {};
  *  @param X Unknown matrix or vector.
  *  @param Y Know matrix or vector.
  *
- *  @return Zero on success and some other value otherwise.
+ *  @return Zero on success and, if a diagonal element of `U` is zero, its
+ *          index plus one.
  *
  *  Solves a linear system of the following form:
  *
@@ -104,11 +333,16 @@ struct can_forward_sub : can_backward_sub<C, D, E> {};
  *  in upper triangular form. The function itself does not check for this and
  *  simply assumes the elements below the main diagonal are all zero.
  *
+ *  All right hand sides are solved for at once in blocks of rows, see
+ *  internal::substitution_upper, and `X` may be `Y` itself to solve in place.
+ *  If a diagonal element is zero, `X` is left untouched.
+ *
  *  Lin assertion errors will be thrown if the dimensions of `X` are not the
  *  same as the dimensions of `Y`.
  *
  *  @sa internal::can_backward_sub
  *  @sa forward_sub
+ *  @sa backward_sub_transposed
  *
  *  @ingroup SUBSTITUTIONS
  */
@@ -120,21 +354,13 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Mapping<D
   LIN_ASSERT(Y.rows() == X.rows());
   LIN_ASSERT(Y.cols() == X.cols());
 
-  // Solve for the last row
-  size_t m = U.rows() - 1;
-  row(X, m) = row(Y, m) / U(m, m);
-
-  // Solve for the other rows in descending order
-  size_t n = m - 1;
-  do {
-    typedef typename C::Traits::elem_t Elem;
-    typedef RowVector<Elem, 0, C::Traits::max_rows> T;
-    typedef std::conditional_t<internal::is_col_vector<E>::value, Vector<Elem, 0, E::Traits::max_rows>, Matrix<Elem, 0, E::Traits::cols, E::Traits::max_rows, E::Traits::max_cols>> V;
-
-    row(X, n) = (row(Y, n) - ref<T>(U, n, n + 1, m - n) * ref<V>(X, n + 1, 0, m - n, X.cols())) / U(n, n);
-  } while (n--);
+  size_t const status = internal::substitution_singular(U);
+  if (status) return status;
 
-  // TODO : Change this to a meaningfull error code
+  // Assigned as a stream so mappings of the same type are copied element by
+  // element rather than through the defaulted copy assignment
+  X = static_cast<internal::Stream<E> const &>(Y);
+  internal::substitution_upper(internal::substitution_normal<C>{U}, X, false);
   return 0;
 }
 
@@ -148,7 +374,8 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Mapping<D
  *  @param X Unknown matrix or vector.
  *  @param Y Know matrix or vector.
  *
- *  @return Zero on success and some other value otherwise.
+ *  @return Zero on success and, if a diagonal element of `U` is zero, its
+ *          index plus one.
  *
  *  Solves a linear system of the following form:
  *
@@ -165,6 +392,7 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Mapping<D
  *
  *  @sa internal::can_backward_sub
  *  @sa forward_sub
+ *  @sa backward_sub_transposed
  *
  *  @ingroup SUBSTITUTIONS
  */
@@ -175,6 +403,73 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Base<D> &
   return backward_sub(U, static_cast<internal::Mapping<D> &>(X), Y);
 }
 
+/** @brief Solves a linear system using backward substitution with the
+ *         transpose of a lower triangular operator.
+ *
+ *  @tparam C
+ *  @tparam D
+ *  @tparam E
+ *
+ *  @param L Lower triangular operator.
+ *  @param X Unknown matrix or vector.
+ *  @param Y Know matrix or vector.
+ *
+ *  @return Zero on success and, if a diagonal element of `L` is zero, its
+ *          index plus one.
+ *
+ *  Solves a linear system of the following form:
+ *
+ *  \f[
+ *    L^T X = Y
+ *  \f]
+ *
+ *  where \f$L\f$ is a lower triangular operator, \f$X\f$ is an unknow matrix
+ *  or vector, and \f$Y\f$ is a known matrix or vector.
+ *
+ *  The transpose is never formed. Paired with forward_sub, this completes a
+ *  solve with a Cholesky factor straight from chol. Only the lower triangle of
+ *  `L` is read. `X` may be `Y` itself to solve in place.
+ *
+ *  Lin assertion errors will be thrown if the dimensions of `X` are not the
+ *  same as the dimensions of `Y`.
+ *
+ *  @sa internal::can_backward_sub
+ *  @sa backward_sub
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C, class D, class E, typename =
+    std::enable_if_t<internal::can_backward_sub<C, D, E>::value>>
+constexpr size_t backward_sub_transposed(internal::Mapping<C> const &L, internal::Mapping<D> &X, internal::Mapping<E> const &Y) {
+  LIN_ASSERT(L.rows() == L.cols());
+  LIN_ASSERT(L.cols() == Y.rows());
+  LIN_ASSERT(Y.rows() == X.rows());
+  LIN_ASSERT(Y.cols() == X.cols());
+
+  size_t const status = internal::substitution_singular(L);
+  if (status) return status;
+
+  X = static_cast<internal::Stream<E> const &>(Y);
+  internal::substitution_upper(internal::substitution_transposed<C>{L}, X, false);
+  return 0;
+}
+
+/** @brief Solves a linear system using backward substitution with the
+ *         transpose of a lower triangular operator.
+ *
+ *  Resizes `X` to match `Y` before solving.
+ *
+ *  @sa backward_sub_transposed
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C, class D, class E, typename =
+    std::enable_if_t<internal::can_backward_sub<C, D, E>::value>>
+constexpr size_t backward_sub_transposed(internal::Mapping<C> const &L, internal::Base<D> &X, internal::Mapping<E> const &Y) {
+  X.resize(Y.rows(), Y.cols());
+  return backward_sub_transposed(L, static_cast<internal::Mapping<D> &>(X), Y);
+}
+
 /** @brief Solves a linear system using forward substitution.
  *
  *  @tparam C
@@ -185,7 +480,8 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Base<D> &
  *  @param X Unknown matrix or vector.
  *  @param Y Known matrix or vector.
  *
- *  @return Zero on success and some other value otherwise.
+ *  @return Zero on success and, if a diagonal element of `L` is zero, its
+ *          index plus one.
  *
  *  Solves a linear system of the following form:
  *
@@ -200,11 +496,16 @@ constexpr size_t backward_sub(internal::Mapping<C> const &U, internal::Base<D> &
  *  lower triangular form. The function itself does not check for this and
  *  simply assumes the elements above the main diagonal are all zero.
  *
+ *  All right hand sides are solved for at once in blocks of rows, see
+ *  internal::substitution_lower, and `X` may be `Y` itself to solve in place.
+ *  If a diagonal element is zero, `X` is left untouched.
+ *
  *  Lin assertion errors will be thrown if the dimensions of `X` are not the
  *  same as the dimensions of `Y`.
  *
  *  @sa internal::can_forward_sub
  *  @sa backward_sub
+ *  @sa forward_sub_transposed
  *
  *  @ingroup SUBSTITUTIONS
  */
@@ -216,19 +517,11 @@ constexpr size_t forward_sub(internal::Mapping<C> const &L, internal::Mapping<D>
   LIN_ASSERT(Y.rows() == X.rows());
   LIN_ASSERT(Y.cols() == X.cols());
 
-  // Solve for the first row
-  row(X, 0) = row(Y, 0) / L(0, 0);
-
-  // Solve for other rows in ascending order
-  for (size_t n = 1; n < X.rows(); n++) {
-    typedef typename C::Traits::elem_t Elem;
-    typedef RowVector<Elem, 0, C::Traits::max_cols> T;
-    typedef std::conditional_t<internal::is_col_vector<E>::value, Vector<Elem, 0, E::Traits::max_rows>, Matrix<Elem, 0, E::Traits::cols, E::Traits::max_rows, E::Traits::max_cols>> V;
-
-    row(X, n) = (row(Y, n) - ref<T>(L, n, 0, n) * ref<V>(X, 0, 0, n, X.cols())) / L(n, n);
-  }
+  size_t const status = internal::substitution_singular(L);
+  if (status) return status;
 
-  // TODO : Change this to a meaningfull error code
+  X = static_cast<internal::Stream<E> const &>(Y);
+  internal::substitution_lower(internal::substitution_normal<C>{L}, X, false);
   return 0;
 }
 
@@ -242,7 +535,8 @@ constexpr size_t forward_sub(internal::Mapping<C> const &L, internal::Mapping<D>
  *  @param X Unknow matrix or vector.
  *  @param Y Known matrix or vector.
  *
- *  @return Zero on success and some other value otherwise.
+ *  @return Zero on success and, if a diagonal element of `L` is zero, its
+ *          index plus one.
  *
  *  Solves a linear system of the following form:
  *
@@ -259,6 +553,7 @@ constexpr size_t forward_sub(internal::Mapping<C> const &L, internal::Mapping<D>
  *
  *  @sa internal::can_forward_sub
  *  @sa backward_sub
+ *  @sa forward_sub_transposed
  *
  *  @ingroup SUBSTITUTIONS
  */
@@ -268,6 +563,72 @@ constexpr size_t forward_sub(internal::Mapping<C> const &L, internal::Base<D> &X
   X.resize(Y.rows(), Y.cols());
   return forward_sub(L, static_cast<internal::Mapping<D> &>(X), Y);
 }
+
+/** @brief Solves a linear system using forward substitution with the
+ *         transpose of an upper triangular operator.
+ *
+ *  @tparam C
+ *  @tparam D
+ *  @tparam E
+ *
+ *  @param U Upper triangular operator.
+ *  @param X Unknown matrix or vector.
+ *  @param Y Known matrix or vector.
+ *
+ *  @return Zero on success and, if a diagonal element of `U` is zero, its
+ *          index plus one.
+ *
+ *  Solves a linear system of the following form:
+ *
+ *  \f[
+ *    U^T X = Y
+ *  \f]
+ *
+ *  where \f$U\f$ is an upper triangular operator, \f$X\f$ is an unknow matrix
+ *  or vector, and \f$Y\f$ is a known matrix or vector.
+ *
+ *  The transpose is never formed and only the upper triangle of `U` is read.
+ *  `X` may be `Y` itself to solve in place.
+ *
+ *  Lin assertion errors will be thrown if the dimensions of `X` are not the
+ *  same as the dimensions of `Y`.
+ *
+ *  @sa internal::can_forward_sub
+ *  @sa forward_sub
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C, class D, class E, typename =
+    std::enable_if_t<internal::can_forward_sub<C, D, E>::value>>
+constexpr size_t forward_sub_transposed(internal::Mapping<C> const &U, internal::Mapping<D> &X, internal::Mapping<E> const &Y) {
+  LIN_ASSERT(U.rows() == U.cols());
+  LIN_ASSERT(U.cols() == Y.rows());
+  LIN_ASSERT(Y.rows() == X.rows());
+  LIN_ASSERT(Y.cols() == X.cols());
+
+  size_t const status = internal::substitution_singular(U);
+  if (status) return status;
+
+  X = static_cast<internal::Stream<E> const &>(Y);
+  internal::substitution_lower(internal::substitution_transposed<C>{U}, X, false);
+  return 0;
+}
+
+/** @brief Solves a linear system using forward substitution with the
+ *         transpose of an upper triangular operator.
+ *
+ *  Resizes `X` to match `Y` before solving.
+ *
+ *  @sa forward_sub_transposed
+ *
+ *  @ingroup SUBSTITUTIONS
+ */
+template <class C, class D, class E, typename =
+    std::enable_if_t<internal::can_forward_sub<C, D, E>::value>>
+constexpr size_t forward_sub_transposed(internal::Mapping<C> const &U, internal::Base<D> &X, internal::Mapping<E> const &Y) {
+  X.resize(Y.rows(), Y.cols());
+  return forward_sub_transposed(U, static_cast<internal::Mapping<D> &>(X), Y);
+}
 } // namespace lin
 
 #endif
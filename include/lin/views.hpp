@@ -106,7 +106,7 @@ using view_t = typename view<C>::type;
 
 template <class C>
 struct view<C, std::enable_if_t<is_matrix<C>::value>> {
-  typedef MatrixView<typename C::Traits::elem_t, C::Traits::rows, C::Traits::cols, C::Traits::max_rows, C::Traits::max_cols> type;
+  typedef MatrixView<typename C::Traits::elem_t, C::Traits::rows, C::Traits::cols, C::Traits::max_rows, C::Traits::max_cols, typename C::Traits::layout> type;
 };
 
 template <class C>
@@ -137,7 +137,7 @@ using const_view_t = typename const_view<C>::type;
 
 template <class C>
 struct const_view<C, std::enable_if_t<is_matrix<C>::value>> {
-  typedef ConstMatrixView<typename C::Traits::elem_t, C::Traits::rows, C::Traits::cols, C::Traits::max_rows, C::Traits::max_cols> type;
+  typedef ConstMatrixView<typename C::Traits::elem_t, C::Traits::rows, C::Traits::cols, C::Traits::max_rows, C::Traits::max_cols, typename C::Traits::layout> type;
 };
 
 template <class C>
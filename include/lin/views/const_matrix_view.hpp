@@ -20,6 +20,7 @@ namespace internal {
  *  @tparam C  Columns at compile time.
  *  @tparam MR Maximum rows at compile time.
  *  @tparam MC Maximum columns at compile time.
+ *  @tparam L  Layout of the backing array, either RowMajor or ColMajor.
  * 
  *  The template parameters specify the matrix view's traits. The traits must
  *  qualify this type as a matrix.
@@ -29,8 +30,8 @@ namespace internal {
  * 
  *  @ingroup VIEWS
  */
-template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C>
-class ConstMatrixView : public ConstTensorView<ConstMatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C, class L = RowMajor>
+class ConstMatrixView : public ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>> {
   static_assert(is_matrix<Matrix<T, R, C, MR, MC>>::value,
       "Invalid ConstMatrixView<...> parameters");
 
@@ -39,40 +40,45 @@ class ConstMatrixView : public ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>
    * 
    *  @sa internal::traits
    */
-  typedef traits<ConstMatrixView<T, R, C, MR, MC>> Traits;
+  typedef traits<ConstMatrixView<T, R, C, MR, MC, L>> Traits;
 
  protected:
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::derived;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::derived;
 
  public:
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::ConstTensorView;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::rows;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::cols;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::size;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::data;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::eval;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::resize;
-  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC>>::operator();
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::ConstTensorView;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::rows;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::cols;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::size;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::data;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::eval;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::resize;
+  using ConstTensorView<ConstMatrixView<T, R, C, MR, MC, L>>::operator();
 
   constexpr ConstMatrixView() = delete;
-  constexpr ConstMatrixView(ConstMatrixView<T, R, C, MR, MC> const &) = default;
-  constexpr ConstMatrixView(ConstMatrixView<T, R, C, MR, MC> &&) = default;
-  constexpr ConstMatrixView<T, R, C, MR, MC> &operator=(ConstMatrixView<T, R, C, MR, MC> const &) = default;
-  constexpr ConstMatrixView<T, R, C, MR, MC> &operator=(ConstMatrixView<T, R, C, MR, MC> &&) = default;
+  constexpr ConstMatrixView(ConstMatrixView<T, R, C, MR, MC, L> const &) = default;
+  constexpr ConstMatrixView(ConstMatrixView<T, R, C, MR, MC, L> &&) = default;
+  constexpr ConstMatrixView<T, R, C, MR, MC, L> &operator=(ConstMatrixView<T, R, C, MR, MC, L> const &) = default;
+  constexpr ConstMatrixView<T, R, C, MR, MC, L> &operator=(ConstMatrixView<T, R, C, MR, MC, L> &&) = default;
 };
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _elem<ConstMatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _elem<ConstMatrixView<T, R, C, MR, MC, L>> {
   typedef T type;
 };
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _dims<ConstMatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _dims<ConstMatrixView<T, R, C, MR, MC, L>> {
   static constexpr size_t rows = R;
   static constexpr size_t cols = C;
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
+
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _layout<ConstMatrixView<T, R, C, MR, MC, L>> {
+  typedef L type;
+};
 }  // namespace internal
 }  // namespace lin
 
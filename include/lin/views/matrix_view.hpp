@@ -20,6 +20,7 @@ namespace internal {
  *  @tparam C  Columns at compile time.
  *  @tparam MR Maximum rows at compile time.
  *  @tparam MC Maximum columns at compile time.
+ *  @tparam L  Layout of the backing array, either RowMajor or ColMajor.
  * 
  *  The template parameters specify the matrix view's traits. The traits must
  *  qualify this type as a matrix.
@@ -30,8 +31,8 @@ namespace internal {
  * 
  *  @ingroup VIEWS
  */
-template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C>
-class MatrixView : public TensorView<MatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR = R, size_t MC = C, class L = RowMajor>
+class MatrixView : public TensorView<MatrixView<T, R, C, MR, MC, L>> {
   static_assert(is_matrix<Matrix<T, R, C, MR, MC>>::value,
       "Invalid MatrixView<...> parameters");
 
@@ -40,41 +41,46 @@ class MatrixView : public TensorView<MatrixView<T, R, C, MR, MC>> {
    * 
    *  @sa internal::traits
    */
-  typedef traits<MatrixView<T, R, C, MR, MC>> Traits;
+  typedef traits<MatrixView<T, R, C, MR, MC, L>> Traits;
 
  protected:
-  using TensorView<MatrixView<T, R, C, MR, MC>>::derived;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::derived;
 
  public:
-  using TensorView<MatrixView<T, R, C, MR, MC>>::TensorView;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::rows;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::cols;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::size;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::data;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::eval;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::resize;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::operator=;
-  using TensorView<MatrixView<T, R, C, MR, MC>>::operator();
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::TensorView;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::rows;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::cols;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::size;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::data;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::eval;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::resize;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::operator=;
+  using TensorView<MatrixView<T, R, C, MR, MC, L>>::operator();
 
   constexpr MatrixView() = default;
-  constexpr MatrixView(MatrixView<T, R, C, MR, MC> const &) = default;
-  constexpr MatrixView(MatrixView<T, R, C, MR, MC> &&) = default;
-  constexpr MatrixView<T, R, C, MR, MC> &operator=(MatrixView<T, R, C, MR, MC> const &) = default;
-  constexpr MatrixView<T, R, C, MR, MC> &operator=(MatrixView<T, R, C, MR, MC> &&) = default;
+  constexpr MatrixView(MatrixView<T, R, C, MR, MC, L> const &) = default;
+  constexpr MatrixView(MatrixView<T, R, C, MR, MC, L> &&) = default;
+  constexpr MatrixView<T, R, C, MR, MC, L> &operator=(MatrixView<T, R, C, MR, MC, L> const &) = default;
+  constexpr MatrixView<T, R, C, MR, MC, L> &operator=(MatrixView<T, R, C, MR, MC, L> &&) = default;
 };
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _elem<MatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _elem<MatrixView<T, R, C, MR, MC, L>> {
   typedef T type;
 };
 
-template <typename T, size_t R, size_t C, size_t MR, size_t MC>
-struct _dims<MatrixView<T, R, C, MR, MC>> {
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _dims<MatrixView<T, R, C, MR, MC, L>> {
   static constexpr size_t rows = R;
   static constexpr size_t cols = C;
   static constexpr size_t max_rows = MR;
   static constexpr size_t max_cols = MC;
 };
+
+template <typename T, size_t R, size_t C, size_t MR, size_t MC, class L>
+struct _layout<MatrixView<T, R, C, MR, MC, L>> {
+  typedef L type;
+};
 }  // namespace internal
 }  // namespace lin
 
@@ -18,7 +18,8 @@ namespace internal {
  * 
  *  This allows users to interpret arbitrary buffers as tensor objects. The user
  *  specified buffer is assumed to be at least as large as the tensor's maximum
- *  size and elements are read and written to the buffer in row major order.
+ *  size and elements are read and written to the buffer in the order given by
+ *  internal::traits::layout.
  *
  *  @sa internal::Base
  *  @sa internal::MatrixView
@@ -66,9 +67,9 @@ class TensorView : public Base<D> {
    * 
    *  @param elems Element backing array.
    * 
-   *  The element backing array is a assumed to be in row major order. Elements
-   *  of the tensor initially hold whatever values were left in the backing
-   *  array.
+   *  The element backing array is a assumed to be in the order given by
+   *  internal::traits::layout. Elements of the tensor initially hold whatever
+   *  values were left in the backing array.
    * 
    *  The backing array should be at least as large as the maximum size of the
    *  tensor (see internal::traits information).
@@ -87,9 +88,9 @@ class TensorView : public Base<D> {
    *  @param r     Initial row dimension.
    *  @param c     Initial column dimension.
    *
-   *  The element backing array is a assumed to be in row major order. Elements
-   *  of the tensor initially hold whatever values were left in the backing
-   *  array.
+   *  The element backing array is a assumed to be in the order given by
+   *  internal::traits::layout. Elements of the tensor initially hold whatever
+   *  values were left in the backing array.
    * 
    *  The backing array should be at least as large as the maximum size of the
    *  tensor (see internal::traits information).
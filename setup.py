@@ -141,7 +141,7 @@ def autocode():
             f'  if (lin::internal::is_col_vector<{cxx_class}>())\n' + \
             '    return py::buffer_info{ self.data(), sizeof(double), py::format_descriptor<double>::format(), 1, {self.rows()}, {sizeof(double)} };\n' + \
             '  else\n' + \
-            '    return py::buffer_info{ self.data(), sizeof(double), py::format_descriptor<double>::format(), 2, {self.rows(), self.cols()}, {self.cols() * sizeof(double), sizeof(double)} };\n' + \
+            '    return py::buffer_info{ self.data(), sizeof(double), py::format_descriptor<double>::format(), 2, {self.rows(), self.cols()}, {self.stride() * sizeof(double), sizeof(double)} };\n' + \
             '});\n' + \
             f'{py_class}.def("__repr__", []({cxx_class} const &self) -> std::string ' + '{\n' + \
             f'  std::stringstream ss; ss << "{py_class}";\n' + \
@@ -200,10 +200,10 @@ def autocode():
             f'  return new {cxx_class}(self);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__iadd__", []({cxx_class} &self, {cxx_class} const &other) -> {cxx_class} & ' + '{\n' \
-            '  return (self = self + other);\n' + \
+            '  return (self += other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__iadd__", []({cxx_class} &self, double other) -> {cxx_class} & ' + '{\n' \
-            '  return (self = self + other);\n' + \
+            '  return (self += other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__add__", []({cxx_class} const &self, {cxx_class} const &other) -> {cxx_class} * ' + '{\n' \
             f'  return new {cxx_class}(self + other);\n' + \
@@ -214,11 +214,11 @@ def autocode():
             f'{py_class}.def("__radd__", []({cxx_class} const &self, double other) -> {cxx_class} * ' + '{\n' \
             f'  return new {cxx_class}(other + self);\n' + \
             '}, py::is_operator());\n' + \
-            f'{py_class}.def("__itruediv____", []({cxx_class} &self, {cxx_class} const &other) -> {cxx_class} & ' + '{\n' \
+            f'{py_class}.def("__itruediv__", []({cxx_class} &self, {cxx_class} const &other) -> {cxx_class} & ' + '{\n' \
             '  return (self = self / other);\n' + \
             '}, py::is_operator());\n' + \
-            f'{py_class}.def("__itruediv____", []({cxx_class} &self, double other) -> {cxx_class} & ' + '{\n' \
-            '  return (self = self / other);\n' + \
+            f'{py_class}.def("__itruediv__", []({cxx_class} &self, double other) -> {cxx_class} & ' + '{\n' \
+            '  return (self /= other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__truediv__", []({cxx_class} const &self, {cxx_class} const &other) -> {cxx_class} * ' + '{\n' \
             f'  return new {cxx_class}(self / other);\n' + \
@@ -230,10 +230,10 @@ def autocode():
             f'  return new {cxx_class}(other / self);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__isub__", []({cxx_class} &self, {cxx_class} const &other) -> {cxx_class} & ' + '{\n' \
-            '  return (self = self - other);\n' + \
+            '  return (self -= other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__isub__", []({cxx_class} &self, double other) -> {cxx_class} & ' + '{\n' \
-            '  return (self = self - other);\n' + \
+            '  return (self -= other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__sub__", []({cxx_class} const &self, {cxx_class} const &other) -> {cxx_class} * ' + '{\n' \
             f'  return new {cxx_class}(self - other);\n' + \
@@ -245,7 +245,7 @@ def autocode():
             f'  return new {cxx_class}(other - self);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__imul__", []({cxx_class} &self, double other) -> {cxx_class} & ' + '{\n' + \
-            f'  return (self = other * self);' + \
+            f'  return (self *= other);\n' + \
             '}, py::is_operator());\n' + \
             f'{py_class}.def("__mul__", []({cxx_class} const &self, double other) -> {cxx_class} * ' + '{\n' + \
             f'  return new {cxx_class}(self * other);\n' + \
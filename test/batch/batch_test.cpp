@@ -0,0 +1,97 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+#include <lin/batch.hpp>
+#include <lin/core.hpp>
+#include <lin/factorizations/chol.hpp>
+#include <lin/generators/identity.hpp>
+#include <lin/generators/randoms.hpp>
+#include <lin/substitutions.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+constexpr static lin::size_t N = 8;
+
+typedef lin::Batch<lin::Matrix3x3d, N> Matrix3x3db;
+typedef lin::Batch<lin::Vector3d, N> Vector3db;
+
+static_assert(std::is_same<Matrix3x3db, lin::Matrix<lin::Lanes<double, N>, 3, 3>>::value, "");
+static_assert(std::is_same<Vector3db, lin::internal::traits_eval_t<
+    lin::internal::StreamMultiply<Matrix3x3db, Vector3db>>>::value, "");
+static_assert(std::is_same<lin::Matrix3x3d, decltype(lin::lane(std::declval<Matrix3x3db &>(), 0).eval())>::value, "");
+
+TEST(Batch, Lanes) {
+  lin::Lanes<double, 4> a(2.0), b(3.0);
+  b[1] = -1.0;
+
+  lin::Lanes<double, 4> c = 2.0 * a + b / 2.0 - 1.0;
+  ASSERT_DOUBLE_EQ(4.5, c[0]);
+  ASSERT_DOUBLE_EQ(2.5, c[1]);
+
+  c = sqrt(a * a) - (-a);
+  ASSERT_DOUBLE_EQ(4.0, c[3]);
+  ASSERT_DOUBLE_EQ(1.0, abs(b)[1]);
+}
+
+TEST(Batch, Operations) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrix3x3d A[N];
+  lin::Vector3d x[N], y[N];
+  Matrix3x3db Ab;
+  Vector3db xb, yb;
+
+  for (lin::size_t k = 0; k < N; k++) {
+    A[k] = lin::rands<lin::Matrix3x3d>(rand);
+    x[k] = lin::rands<lin::Vector3d>(rand);
+    y[k] = lin::rands<lin::Vector3d>(rand);
+    lin::lane(Ab, k) = A[k];
+    lin::lane(xb, k) = x[k];
+    lin::lane(yb, k) = y[k];
+  }
+
+  Vector3db zb = Ab * xb + 2.0 * yb;
+  Vector3db cb = lin::cross(xb, yb);
+  auto db = lin::dot(xb, yb);
+  auto nb = lin::norm(zb);
+  for (lin::size_t k = 0; k < N; k++) {
+    lin::Vector3d const z = A[k] * x[k] + 2.0 * y[k];
+    lin::Vector3d const c = lin::cross(x[k], y[k]);
+    lin::Vector3d const g = lin::lane(zb, k);
+    for (lin::size_t i = 0; i < 3; i++) {
+      ASSERT_NEAR(z(i), g(i), 1e-12);
+      ASSERT_NEAR(c(i), lin::lane(cb, k)(i), 1e-12);
+    }
+    ASSERT_NEAR(lin::dot(x[k], y[k]), db[k], 1e-12);
+    ASSERT_NEAR(lin::norm(z), nb[k], 1e-12);
+  }
+
+  // Gathering from an expression
+  lin::Matrix3x3d const B = lin::lane(Ab * Ab, 5);
+  lin::Matrix3x3d const C = A[5] * A[5];
+  for (lin::size_t i = 0; i < B.size(); i++) ASSERT_NEAR(C(i), B(i), 1e-12);
+}
+
+TEST(Batch, CholeskySolve) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrix3x3d M[N];
+  Matrix3x3db Lb;
+  Vector3db xb, yb, zb;
+
+  for (lin::size_t k = 0; k < N; k++) {
+    M[k] = lin::rands<lin::Matrix3x3d>(rand) + 3.0 * lin::identity<lin::Matrix3x3d>();
+    lin::lane(Lb, k) = M[k] * lin::transpose(M[k]);
+    lin::lane(xb, k) = lin::rands<lin::Vector3d>(rand);
+  }
+  Vector3db const bb = Lb * xb;
+
+  ASSERT_EQ(0, lin::chol(Lb));
+  ASSERT_EQ(0, lin::forward_sub(Lb, yb, bb));
+  ASSERT_EQ(0, lin::backward_sub(lin::transpose(Lb).eval(), zb, yb));
+  for (lin::size_t k = 0; k < N; k++) {
+    lin::Matrix3x3d L = M[k] * lin::transpose(M[k]);
+    lin::chol(L);
+    for (lin::size_t i = 0; i < L.size(); i++) ASSERT_NEAR(L(i), lin::lane(Lb, k)(i), 1e-12);
+    for (lin::size_t i = 0; i < 3; i++) ASSERT_NEAR(lin::lane(xb, k)(i), lin::lane(zb, k)(i), 1e-10);
+  }
+}
@@ -0,0 +1,163 @@
+/** @file test/core/operations_gemm_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+using namespace lin::internal;
+
+static_assert(is_value_backed<lin::Matrix3x3d>::value, "");
+static_assert(!is_value_backed<decltype(lin::Matrix3x3d() + lin::Matrix3x3d())>::value, "");
+static_assert(!is_value_backed<decltype(lin::Matrix3x3d() * lin::Matrix3x3d())>::value, "");
+
+static_assert(_affine<decltype(lin::Matrix3x3d() * lin::Vector3d() + lin::Vector3d())>::value, "");
+static_assert(_affine<decltype(lin::Vector3d() - 2.0 * (lin::Matrix3x3d() * lin::Vector3d()))>::value, "");
+static_assert(_affine<decltype(2.0 * lin::Matrix3x3d() * lin::Matrix3x3d() + 0.5 * lin::Matrix3x3d())>::value, "");
+static_assert(!_affine<decltype(lin::Matrix3x3d() * lin::Matrix3x3d())>::value, "");
+static_assert(!_affine<decltype(lin::Matrix3x3d() + lin::Matrix3x3d())>::value, "");
+
+template <class C, class D, class E>
+static void expect_product(lin::internal::Stream<C> const &c,
+    lin::internal::Stream<D> const &d, lin::internal::Stream<E> const &e) {
+  ASSERT_EQ(c.rows(), e.rows());
+  ASSERT_EQ(d.cols(), e.cols());
+  for (lin::size_t i = 0; i < e.rows(); i++) {
+    for (lin::size_t j = 0; j < e.cols(); j++) {
+      double x = 0.0;
+      for (lin::size_t k = 0; k < c.cols(); k++) x += c(i, k) * d(k, j);
+      ASSERT_DOUBLE_EQ(x, e(i, j));
+    }
+  }
+}
+
+TEST(CoreOperationsGemm, ValueBacked) {
+  lin::Matrixd<0, 0, 18, 18> A(17, 11), B(11, 13), C(17, 13);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 3.0;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 2.0 - 0.25 * i;
+
+  C = A * B;
+  expect_product(A, B, C);
+
+  // Every block shape along the edges of the result
+  for (lin::size_t m = 1; m < 10; m++) {
+    for (lin::size_t n = 1; n < 18; n++) {
+      lin::Matrixd<0, 0, 18, 18> D(m, 5), E(5, n), F(m, n);
+      for (lin::size_t i = 0; i < D.size(); i++) D(i) = double(i % 7);
+      for (lin::size_t i = 0; i < E.size(); i++) E(i) = double(i % 5) - 2.0;
+
+      F = D * E;
+      expect_product(D, E, F);
+    }
+  }
+}
+
+TEST(CoreOperationsGemm, Packed) {
+  lin::Matrix4x4f A;
+  lin::Matrixf<4, 6> B;
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = float(i) / 4.0f;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = float(i) - 3.0f;
+
+  lin::Matrixf<6, 4> C = lin::transpose(A * B);
+  lin::Matrix4x4f const At = lin::transpose(A);
+  expect_product(lin::transpose(B), At, C);
+
+  lin::Matrixf<4, 6> D = (A + A) * B;
+  lin::Matrix4x4f const AA = A + A;
+  expect_product(AA, B, D);
+
+  lin::Matrixf<4, 6> E = A * (A * B);
+  lin::Matrixf<4, 6> const AB = A * B;
+  expect_product(A, AB, E);
+
+  lin::Vector4f f = lin::col(B, 2);
+  lin::Vector4f g = A * lin::col(B, 2);
+  expect_product(A, f, g);
+}
+
+TEST(CoreOperationsGemm, Destinations) {
+  lin::Matrix3x3d A({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  lin::Matrixd<3, 5> B;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = double(i);
+
+  lin::Matrixd<5, 5> C = lin::zeros<lin::Matrixd<5, 5>>();
+  lin::ref<lin::Matrixd<3, 5>>(C, 1, 0) = A * B;
+  expect_product(A, B, lin::ref<lin::Matrixd<3, 5>>(C, 1, 0));
+  for (lin::size_t j = 0; j < 5; j++) {
+    ASSERT_DOUBLE_EQ(0.0, C(0, j));
+    ASSERT_DOUBLE_EQ(0.0, C(4, j));
+  }
+
+  auto const D = (A * B).eval();
+  static_assert(std::is_same<decltype(D), lin::Matrixd<3, 5> const>::value, "");
+  expect_product(A, B, D);
+}
+
+TEST(CoreOperationsGemm, Unrolled) {
+  lin::Matrixd<6, 6> A;
+  lin::Matrixd<6, 4> B;
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 4.0;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 3.0 - 0.125 * i;
+
+  lin::Matrixd<6, 4> C = A * B;
+  expect_product(A, B, C);
+
+  lin::Matrixd<6, 4> D = A * (B + B);
+  lin::Matrixd<6, 4> const BB = B + B;
+  expect_product(A, BB, D);
+
+  lin::Vector3d x({1.0, -2.0, 0.5});
+  lin::Matrix3x3d E = lin::ref<lin::Matrix3x3d>(A, 1, 2);
+  lin::Vector3d y = E * x;
+  expect_product(E, x, y);
+  ASSERT_DOUBLE_EQ(y(1), (E * x)(1));
+}
+
+TEST(CoreOperationsGemm, Affine) {
+  lin::Matrixd<0, 0, 9, 9> A(9, 7), B(7, 6), C(9, 6);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 4.0;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 1.0 + 0.25 * i;
+  for (lin::size_t i = 0; i < C.size(); i++) C(i) = double(i % 5) - 2.0;
+
+  lin::Matrixd<0, 0, 9, 9> const AB = A * B;
+  auto expect_affine = [&](double alpha, double beta, lin::Matrixd<0, 0, 9, 9> const &X) {
+    for (lin::size_t i = 0; i < X.size(); i++) ASSERT_DOUBLE_EQ(alpha * AB(i) + beta * C(i), X(i));
+  };
+
+  lin::Matrixd<0, 0, 9, 9> D = A * B + C;
+  expect_affine(1.0, 1.0, D);
+  D = C - A * B;
+  expect_affine(-1.0, 1.0, D);
+  D = 2.0 * A * B - 0.5 * C;
+  expect_affine(2.0, -0.5, D);
+  D = C * 3.0 + (A * B) * 0.25;
+  expect_affine(0.25, 3.0, D);
+
+  // Accumulating into the destination doesn't need a temporary
+  D = C;
+  ASSERT_FALSE((A * B + D).aliases(D.region(), true));
+  D = A * B + D;
+  expect_affine(1.0, 1.0, D);
+
+  // Lazily evaluated addends are evaluated into the destination first
+  lin::Matrixd<0, 0, 9, 9> I(6, 6), E(9, 6);
+  for (lin::size_t i = 0; i < I.size(); i++) I(i) = (i % 7 == 0) ? 1.0 : 0.0;
+  E = A * B - C * I;
+  expect_affine(1.0, -1.0, E);
+
+  // Small, fixed size expressions with the destination on the right hand side
+  lin::Matrix3x3d F({1.0, 2.0, 0.0, 0.0, 1.0, 3.0, 4.0, 0.0, 1.0});
+  lin::Vector3d x({1.0, 2.0, 3.0}), b({0.5, -1.0, 2.0});
+  x = F * x + b;
+  ASSERT_DOUBLE_EQ( 5.5, x(0));
+  ASSERT_DOUBLE_EQ(10.0, x(1));
+  ASSERT_DOUBLE_EQ( 9.0, x(2));
+  x = b - 2.0 * (F * b);
+  ASSERT_DOUBLE_EQ(  3.5, x(0));
+  ASSERT_DOUBLE_EQ(-11.0, x(1));
+  ASSERT_DOUBLE_EQ( -6.0, x(2));
+}
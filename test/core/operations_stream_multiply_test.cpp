@@ -0,0 +1,69 @@
+/** @file test/core/operations_stream_multiply_test.cpp
+ *  @author Kyle Krol */
+
+static int materializations = 0;
+
+#define LIN_MATERIALIZE_HOOK(T, r, c) (materializations++, (void) (r), (void) (c))
+
+#include <lin/core.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace lin::internal;
+
+static_assert(!has_lazy_product<lin::Matrixd<5, 7>>::value, "");
+static_assert(!has_lazy_product<decltype(lin::Matrixd<5, 7>() + lin::Matrixd<5, 7>())>::value, "");
+static_assert(has_lazy_product<decltype(lin::Matrixd<5, 7>() * lin::Matrixd<7, 5>())>::value, "");
+static_assert(has_lazy_product<decltype(
+    lin::transpose(lin::Matrixd<5, 7>() * lin::Matrixd<7, 5>()) + lin::Matrixd<5, 5>()
+  )>::value, "");
+
+TEST(CoreOperationsStreamMultiply, NestedProducts) {
+  lin::Matrixd<5, 7> A;
+  lin::Matrixd<7, 5> B;
+  lin::Matrixd<5, 5> C;
+  for (lin::size_t i = 0; i < A.size(); i++) {
+    A(i) = 0.5 * i - 4.0;
+    B(i) = 1.0 + 0.25 * i;
+  }
+  for (lin::size_t i = 0; i < C.size(); i++) C(i) = double(i % 3);
+
+  lin::Matrixd<5, 5> const AB = A * B;
+  lin::Matrixd<5, 5> ABC;
+  for (lin::size_t i = 0; i < 5; i++) {
+    for (lin::size_t j = 0; j < 5; j++) {
+      ABC(i, j) = 0.0;
+      for (lin::size_t k = 0; k < 5; k++) ABC(i, j) += AB(i, k) * C(k, j);
+    }
+  }
+
+  materializations = 0;
+  lin::Matrixd<5, 5> D = A * B * C;
+  ASSERT_EQ(1, materializations);
+  for (lin::size_t i = 0; i < D.size(); i++) ASSERT_DOUBLE_EQ(ABC(i), D(i));
+
+  // Element access on the lazy product uses the evaluated operand
+  materializations = 0;
+  auto const p = (A * B) * C;
+  ASSERT_EQ(1, materializations);
+  for (lin::size_t i = 0; i < D.size(); i++) ASSERT_DOUBLE_EQ(ABC(i), p(i));
+
+  materializations = 0;
+  lin::Matrixd<5, 5> E = C * (lin::transpose(A * B) + C) + C;
+  ASSERT_EQ(1, materializations);
+  lin::Matrixd<5, 5> const F = lin::transpose(AB) + C;
+  for (lin::size_t i = 0; i < 5; i++) {
+    for (lin::size_t j = 0; j < 5; j++) {
+      double x = C(i, j);
+      for (lin::size_t k = 0; k < 5; k++) x += C(i, k) * F(k, j);
+      ASSERT_DOUBLE_EQ(x, E(i, j));
+    }
+  }
+
+  // Operands without a lazy product are never evaluated into temporaries
+  materializations = 0;
+  lin::Matrixd<5, 5> G = (C + C) * lin::transpose(C);
+  ASSERT_EQ(0, materializations);
+  (void) G;
+}
@@ -16,6 +16,25 @@ TEST(CoreOperationsMatrixOperations, Trace) {
     0.0f, -7.0f, -1.0f
   };
   ASSERT_FLOAT_EQ(5.0f, lin::trace(A));
+
+  lin::Matrixf<0, 0, 3, 3> B(3, 3);
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = A(i);
+  ASSERT_FLOAT_EQ(lin::trace(A), lin::trace(B));
+}
+
+TEST(CoreOperationsMatrixOperations, TransposeInplace) {
+  lin::Matrixd<0, 0, 40, 40> A(35, 35);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = double(i);
+  lin::Matrixd<0, 0, 40, 40> const B = lin::transpose(A);
+
+  lin::transpose_inplace(A);
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_EQ(B(i), A(i));
+
+  lin::Matrix3x3d C({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  lin::transpose_inplace(lin::transpose(C));
+  ASSERT_EQ(4.0, C(0, 1));
+  ASSERT_EQ(2.0, C(1, 0));
+  ASSERT_EQ(8.0, C(1, 2));
 }
 /* END: From amtrix operations */
 
@@ -74,6 +93,11 @@ TEST(CoreOperationsTensorOperations, Fro) {
 
   lin::Matrixf<0, 0, 4, 4> B(3, 2, {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
   ASSERT_FLOAT_EQ(55.0f, lin::fro(B));
+
+  lin::Matrixf<6, 6> C;
+  lin::Matrixf<0, 0, 6, 6> D(6, 6);
+  for (lin::size_t i = 0; i < C.size(); i++) C(i) = D(i) = 0.5f * i - 4.0f;
+  ASSERT_FLOAT_EQ(lin::fro(D), lin::fro(C));
 }
 
 TEST(CoreOperationsTensorOperations, Multiply) {
@@ -176,6 +200,48 @@ TEST(CoreOperationsTensorOperations, Sum) {
     -1.0f, 0.0f
   };
   ASSERT_FLOAT_EQ(2.0f, lin::sum(A));
+
+  lin::Matrixf<0, 0, 2, 2> B(2, 2);
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = A(i);
+  ASSERT_FLOAT_EQ(lin::sum(A), lin::sum(B));
+}
+
+TEST(CoreOperationsTensorOperations, Reductions) {
+  using namespace lin::internal;
+
+  typedef lin::Matrix<double, 0, 0, 40, 40, lin::Storage<32, true>> Matrix40x40da;
+  typedef lin::Matrix<double, 0, 0, 40, 40, lin::ColMajorStorage> Matrix40x40dc;
+  static_assert(std::is_same<_reduce_packets<lin::RowMajor>, _reduce_path_t<Matrix40x40da>>::value, "");
+  static_assert(std::is_same<_reduce_packets<lin::ColMajor>, _reduce_path_t<Matrix40x40dc>>::value, "");
+
+  // Sizes straddle the accumulator, packet, and tail boundaries
+  for (lin::size_t n = 1; n <= 37; n += 3) {
+    Matrix40x40da A(n, 37);
+    Matrix40x40dc B(n, 37);
+    lin::Matrixd<0, 0, 40, 40> C(n, 37);
+    double s = 0.0, f = 0.0, t = 0.0;
+    for (lin::size_t i = 0; i < n; i++) {
+      for (lin::size_t j = 0; j < 37; j++) {
+        A(i, j) = B(i, j) = C(i, j) = 0.5 * (i * 37 + j) - 3.0;
+        s += A(i, j);
+        f += A(i, j) * A(i, j);
+      }
+      t += A(i, i);
+    }
+
+    ASSERT_DOUBLE_EQ(s, lin::sum(A));
+    ASSERT_DOUBLE_EQ(s, lin::sum(B));
+    ASSERT_DOUBLE_EQ(s, lin::sum(lin::transpose(C)));
+    ASSERT_DOUBLE_EQ(f, lin::fro(A));
+    ASSERT_DOUBLE_EQ(f, lin::fro(B));
+    ASSERT_DOUBLE_EQ(f, lin::fro(lin::transpose(A)));
+    ASSERT_DOUBLE_EQ(2.0 * s, lin::sum(lin::add(A, A)));
+
+    lin::Matrixd<0, 0, 40, 40> D(n, n);
+    for (lin::size_t i = 0; i < n; i++)
+      for (lin::size_t j = 0; j < n; j++) D(i, j) = C(i, j);
+    ASSERT_DOUBLE_EQ(t, lin::trace(D));
+  }
 }
 
 TEST(CoreOperationsTensorOperations, MappingTranspose) {
@@ -205,6 +271,30 @@ TEST(CoreOperationsTensorOperations, MappingTranspose) {
   ASSERT_EQ(8, transpose_C.size());
 }
 
+TEST(CoreOperationsTensorOperations, TiledTranspose) {
+  typedef lin::Matrixd<0, 0, 40, 40> Matrix40x40d;
+  typedef lin::Matrix<double, 0, 0, 40, 40, lin::ColMajorStorage> Matrix40x40dc;
+
+  Matrix40x40d A(37, 29);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = double(i);
+
+  Matrix40x40d const B = lin::transpose(A);
+  Matrix40x40dc C(37, 29);
+  C = A;
+  Matrix40x40d D(37, 29);
+  D = C;
+  Matrix40x40d E(29, 37);
+  lin::transpose(E) = A;
+  for (lin::size_t i = 0; i < A.rows(); i++) {
+    for (lin::size_t j = 0; j < A.cols(); j++) {
+      ASSERT_EQ(A(i, j), B(j, i));
+      ASSERT_EQ(A(i, j), C(i, j));
+      ASSERT_EQ(A(i, j), D(i, j));
+      ASSERT_EQ(A(i, j), E(j, i));
+    }
+  }
+}
+
 TEST(CoreOperationsTensorOperations, StreamTranspose) {
   lin::Matrix2x2f const A({0.0f, 1.0f, 2.0f, 3.0f});
   auto const transpose_A = lin::transpose(A);
@@ -3,6 +3,7 @@
 
 #include <lin/core/types.hpp>
 #include <lin/core/operations/tensor_operators.hpp>
+#include <lin/generators/randoms.hpp>
 
 #include <gtest/gtest.h>
 
@@ -25,6 +26,74 @@ TEST(CoreOperationsTensorOperators, Add) {
   ASSERT_DOUBLE_EQ( 1.0, e(1));
 }
 
+TEST(CoreOperationsTensorOperators, CompoundAssignment) {
+  lin::Vector2f a {1.0f, 2.0f};
+  lin::Vector2f b {1.0f, 3.0f};
+
+  a += b;
+  ASSERT_FLOAT_EQ(2.0f, a(0));
+  ASSERT_FLOAT_EQ(5.0f, a(1));
+
+  a -= 2.0f * b;
+  ASSERT_FLOAT_EQ( 0.0f, a(0));
+  ASSERT_FLOAT_EQ(-1.0f, a(1));
+
+  (a += 1.0f) *= 4.0f;
+  ASSERT_FLOAT_EQ(4.0f, a(0));
+  ASSERT_FLOAT_EQ(0.0f, a(1));
+
+  b /= 2.0f;
+  b -= 0.5f;
+  ASSERT_FLOAT_EQ(0.0f, b(0));
+  ASSERT_FLOAT_EQ(1.0f, b(1));
+
+  lin::Matrixd<0, 0, 4, 4> A(3, 2, {
+    1.0, 2.0,
+    3.0, 4.0,
+    5.0, 6.0
+  });
+  lin::Matrixd<0, 0, 4, 4> B(2, 2, {
+    1.0, 1.0,
+    0.0, 2.0
+  });
+  A *= B;
+  ASSERT_EQ(3, A.rows());
+  ASSERT_EQ(2, A.cols());
+  ASSERT_DOUBLE_EQ( 1.0, A(0, 0));
+  ASSERT_DOUBLE_EQ( 5.0, A(0, 1));
+  ASSERT_DOUBLE_EQ( 3.0, A(1, 0));
+  ASSERT_DOUBLE_EQ(11.0, A(1, 1));
+  ASSERT_DOUBLE_EQ( 5.0, A(2, 0));
+  ASSERT_DOUBLE_EQ(17.0, A(2, 1));
+
+  // Aliased and lazily evaluated right hand sides
+  lin::Matrix2x2d C({1.0, 2.0, 3.0, 4.0});
+  C *= C;
+  ASSERT_DOUBLE_EQ( 7.0, C(0, 0));
+  ASSERT_DOUBLE_EQ(10.0, C(0, 1));
+  ASSERT_DOUBLE_EQ(15.0, C(1, 0));
+  ASSERT_DOUBLE_EQ(22.0, C(1, 1));
+
+  lin::Matrix2x2d D({1.0, 0.0, 0.0, 1.0});
+  D *= (C * 0.5) * lin::transpose(D);
+  ASSERT_DOUBLE_EQ( 3.5, D(0, 0));
+  ASSERT_DOUBLE_EQ( 5.0, D(0, 1));
+  ASSERT_DOUBLE_EQ(11.0, D(1, 1));
+
+  D += lin::transpose(D);
+  ASSERT_DOUBLE_EQ(12.5, D(0, 1));
+  ASSERT_DOUBLE_EQ(12.5, D(1, 0));
+
+  // Rounds exactly as the equivalent product assignment
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<9, 12> const E = lin::rands<lin::Matrixd<9, 12>>(rand);
+  lin::Matrixd<12, 12> const F = lin::rands<lin::Matrixd<12, 12>>(rand);
+  lin::Matrixd<9, 12> G = E, H = E;
+  G *= F;
+  H = H * F;
+  for (lin::size_t i = 0; i < G.size(); i++) ASSERT_EQ(H(i), G(i));
+}
+
 TEST(CoreOperationsTensorOperators, Divide) {
   lin::Vectorf<0, 3> a(2, {12.0f, 9.0f});
   lin::Vectorf<0, 3> b(2, { 2.0f, 3.0f});
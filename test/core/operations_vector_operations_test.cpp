@@ -27,6 +27,24 @@ TEST(CoreOperationsVectorOperations, Dot) {
   u = {1.0f, 3.0f, 1.0f};
   v = {2.0f, 1.0f, 3.0f};
   ASSERT_FLOAT_EQ(8.0f, lin::dot(u, v));
+
+  lin::Vectord<6> w, x;
+  lin::Vectord<0, 6> y(6), z(6);
+  for (lin::size_t i = 0; i < w.size(); i++) {
+    w(i) = y(i) = 0.25 * i;
+    x(i) = z(i) = 1.0 - i;
+  }
+  ASSERT_DOUBLE_EQ(lin::dot(y, z), lin::dot(w, x));
+
+  lin::Vectord<0, 40> a(37), b(37);
+  double d = 0.0;
+  for (lin::size_t i = 0; i < a.size(); i++) {
+    a(i) = 0.5 * i - 4.0;
+    b(i) = 2.0 - 0.25 * i;
+    d += a(i) * b(i);
+  }
+  ASSERT_DOUBLE_EQ(d, lin::dot(a, b));
+  ASSERT_DOUBLE_EQ(d, lin::dot(b, a));
 }
 
 TEST(CoreOperationsVectorOperations, Norm) {
@@ -70,6 +70,9 @@ static_assert( disjunction<F, F, T>(), "");
 static_assert( negation<F>(), "");
 static_assert(!negation<T>(), "");
 
+static_assert(std::is_same<unroll_t<true, 3>, std::index_sequence<0, 1, 2>>(), "");
+static_assert(std::is_same<unroll_t<false, 3>, std::false_type>(), "");
+
 
 // Test traits/tensor.hpp
 
@@ -108,6 +111,12 @@ static_assert(!has_fixed_dimensions<TraitsBFf>(), "");
 static_assert(!has_fixed_dimensions<TraitsBBf>(), "");
 static_assert(!has_fixed_dimensions<TraitsXXf>(), "");
 
+static_assert( is_unrollable<TraitsFFf>(), "");
+static_assert(!is_unrollable<TraitsFBf>(), "");
+static_assert(!is_unrollable<TraitsBBf>(), "");
+static_assert( is_unrollable<Traits<float, 6, 6, 6, 6>>(), "");
+static_assert(!is_unrollable<Traits<float, 7, 1, 7, 1>>(), "");
+
 static_assert(!has_strictly_bounded_rows<TraitsFFf>(), "");
 static_assert(!has_strictly_bounded_rows<TraitsFBf>(), "");
 static_assert( has_strictly_bounded_rows<TraitsBFf>(), "");
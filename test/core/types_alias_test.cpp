@@ -0,0 +1,145 @@
+/** @file test/core/types_alias_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace lin::internal;
+
+static_assert(has_region<lin::Matrix3x3d>::value, "");
+static_assert(has_region<decltype(lin::transpose(std::declval<lin::Matrix3x3d &>()))>::value, "");
+static_assert(!has_region<decltype(lin::Matrix3x3d() + lin::Matrix3x3d())>::value, "");
+
+// Assignments remain usable in constant expressions
+constexpr lin::Matrix2x2d constexpr_assign() {
+  lin::Matrix2x2d A({1.0, 2.0, 3.0, 4.0}), B({0.0, 1.0, 1.0, 0.0});
+  B = A * B;
+  A = lin::transpose(A);
+  B *= A;
+  return B;
+}
+
+constexpr static lin::Matrix2x2d C = constexpr_assign();
+static_assert(C(0, 0) == 4.0, "");
+static_assert(C(0, 1) == 10.0, "");
+static_assert(C(1, 0) == 10.0, "");
+static_assert(C(1, 1) == 24.0, "");
+
+TEST(CoreTypesAlias, Regions) {
+  lin::Matrixd<4, 4> A;
+  Region const a = A.region();
+  ASSERT_EQ(16 * sizeof(double), a.last() - a.origin);
+
+  // Blocks of the same matrix are tested exactly
+  Region const b = a.block(0, 0, 2, 2), c = a.block(0, 2, 2, 2), d = a.block(1, 1, 2, 2);
+  ASSERT_FALSE(b.overlaps(c));
+  ASSERT_FALSE(c.overlaps(b));
+  ASSERT_TRUE(b.overlaps(d));
+  ASSERT_TRUE(c.overlaps(d));
+  ASSERT_FALSE(a.block(0, 1, 4, 1).overlaps(a.block(0, 2, 4, 1)));
+  ASSERT_FALSE(a.block(2, 0, 2, 4).overlaps(a.block(0, 0, 2, 4)));
+
+  // Positional reads from the exact region being written are safe
+  ASSERT_FALSE(region_aliases(a, a, true));
+  ASSERT_TRUE(region_aliases(a, a, false));
+  ASSERT_TRUE(region_aliases(a.transpose(), a, true));
+  ASSERT_TRUE(region_aliases(a.diagonal(), a.block(0, 0, 4, 1), true));
+}
+
+TEST(CoreTypesAlias, MatrixVectorProduct) {
+  lin::Matrix3x3d A({
+    1.0, 2.0, 0.0,
+    0.0, 1.0, 3.0,
+    4.0, 0.0, 1.0
+  });
+  lin::Vector3d x({1.0, 2.0, 3.0});
+  ASSERT_TRUE((A * x).aliases(x.region(), true));
+  ASSERT_FALSE((A * x).aliases(lin::Vector3d().region(), true));
+
+  x = A * x;
+  ASSERT_DOUBLE_EQ(5.0, x(0));
+  ASSERT_DOUBLE_EQ(11.0, x(1));
+  ASSERT_DOUBLE_EQ(7.0, x(2));
+
+  lin::Matrixd<0, 0, 6, 6> B(5, 5);
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 0.5 * i - 4.0;
+  lin::Matrixd<0, 0, 6, 6> C = B * B;
+  B = B * B;
+  for (lin::size_t i = 0; i < B.size(); i++) ASSERT_DOUBLE_EQ(C(i), B(i));
+}
+
+TEST(CoreTypesAlias, Transpose) {
+  lin::Matrixd<0, 0, 5, 5> A(4, 4), B(4, 4);
+  for (lin::size_t i = 0; i < A.size(); i++) B(i) = A(i) = 1.0 + i;
+
+  ASSERT_TRUE(lin::transpose(A).aliases(A.region(), true));
+  A = lin::transpose(A);
+  for (lin::size_t i = 0; i < 4; i++)
+    for (lin::size_t j = 0; j < 4; j++) ASSERT_DOUBLE_EQ(B(j, i), A(i, j));
+
+  lin::Matrix3x3d C({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  C = C + lin::transpose(C);
+  ASSERT_DOUBLE_EQ(2.0, C(0, 0));
+  ASSERT_DOUBLE_EQ(6.0, C(0, 1));
+  ASSERT_DOUBLE_EQ(6.0, C(1, 0));
+  ASSERT_DOUBLE_EQ(14.0, C(1, 2));
+}
+
+TEST(CoreTypesAlias, ElementWise) {
+  lin::Matrix3x3d X({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  lin::Matrix3x3d Y = lin::ones<lin::Matrix3x3d>();
+
+  // Element for element reads never need a temporary
+  ASSERT_FALSE((X + Y).aliases(X.region(), true));
+  ASSERT_FALSE((2.0 * X - Y).aliases(X.region(), true));
+  X = X + Y;
+  for (lin::size_t i = 0; i < X.size(); i++) ASSERT_DOUBLE_EQ(2.0 + i, X(i));
+}
+
+TEST(CoreTypesAlias, References) {
+  lin::Matrixd<4, 4> Q;
+  for (lin::size_t i = 0; i < Q.size(); i++) Q(i) = 1.0 + i;
+  lin::Matrixd<4, 4> R = Q;
+
+  // Distinct columns of the same matrix don't overlap
+  ASSERT_FALSE((lin::col(Q, 1) - lin::col(Q, 0)).aliases(lin::col(Q, 1).region(), true));
+  lin::col(Q, 1) = lin::col(Q, 1) - lin::col(Q, 0);
+  for (lin::size_t i = 0; i < 4; i++) ASSERT_DOUBLE_EQ(R(i, 1) - R(i, 0), Q(i, 1));
+
+  // Overlapping, shifted blocks must be copied through a temporary
+  Q = R;
+  ASSERT_TRUE(lin::ref<lin::Matrix2x2d>(Q, 0, 0).aliases(lin::ref<lin::Matrix2x2d>(Q, 1, 1).region(), true));
+  lin::Matrixd<4, 4> const &P = Q;
+  ASSERT_TRUE(lin::ref<lin::Matrix3x3d>(P, 0, 0).aliases(lin::ref<lin::Matrix3x3d>(Q, 1, 1).region(), true));
+  lin::ref<lin::Matrix3x3d>(Q, 1, 1) = lin::ref<lin::Matrix3x3d>(P, 0, 0);
+  for (lin::size_t i = 0; i < 3; i++)
+    for (lin::size_t j = 0; j < 3; j++) ASSERT_DOUBLE_EQ(R(i, j), Q(i + 1, j + 1));
+
+  // Diagonals of a matrix overlap its rows and columns
+  Q = R;
+  lin::col(Q, 0) = lin::diag(Q);
+  ASSERT_DOUBLE_EQ(R(0, 0), Q(0, 0));
+  ASSERT_DOUBLE_EQ(R(1, 1), Q(1, 0));
+  ASSERT_DOUBLE_EQ(R(2, 2), Q(2, 0));
+  ASSERT_DOUBLE_EQ(R(3, 3), Q(3, 0));
+}
+
+TEST(CoreTypesAlias, NoAlias) {
+  lin::Matrix3x3d A({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  lin::Matrix3x3d B = lin::zeros<lin::Matrix3x3d>();
+  lin::Vector3d x({1.0, 1.0, 1.0}), y;
+
+  lin::noalias(y) = A * x;
+  ASSERT_DOUBLE_EQ(6.0, y(0));
+  ASSERT_DOUBLE_EQ(15.0, y(1));
+  ASSERT_DOUBLE_EQ(24.0, y(2));
+
+  lin::noalias(B) = lin::transpose(A);
+  ASSERT_DOUBLE_EQ(4.0, B(0, 1));
+
+  lin::noalias(lin::col(B, 0)) = y;
+  ASSERT_DOUBLE_EQ(15.0, B(1, 0));
+}
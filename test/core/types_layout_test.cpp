@@ -0,0 +1,139 @@
+/** @file test/core/types_layout_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/references.hpp>
+#include <lin/views.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+
+using namespace lin::internal;
+
+typedef lin::Matrix<double, 3, 4, 3, 4, lin::ColMajorStorage> Matrix3x4dc;
+typedef lin::Matrix<double, 4, 3, 4, 3, lin::ColMajorStorage> Matrix4x3dc;
+typedef lin::Matrix<double, 0, 0, 9, 9, lin::ColMajorStorage> Matrix9x9dc;
+typedef lin::Matrix<double, 0, 0, 7, 7, lin::Storage<32, true, lin::ColMajor>> Matrix7x7dac;
+
+static_assert(is_col_major<Matrix3x4dc>::value, "");
+static_assert(!is_col_major<lin::Matrix3x3d>::value, "");
+static_assert(is_col_major<decltype(lin::transpose(lin::Matrix3x3d()))>::value, "");
+static_assert(is_col_major<decltype(lin::ref<lin::Matrix2x2d>(std::declval<Matrix3x4dc &>(), 0, 0))>::value, "");
+static_assert(Matrix3x4dc::Traits::stride == 0, "");
+static_assert(Matrix7x7dac::Traits::stride == 8, "");
+static_assert(_storage<Matrix7x7dac>::size == 56, "");
+
+static_assert(have_packet_access<Matrix3x4dc, decltype(Matrix3x4dc() + lin::ones<Matrix3x4dc>())>::value, "");
+static_assert(have_packet_access<Matrix3x4dc, decltype(lin::transpose(lin::Matrixd<4, 3>()))>::value, "");
+static_assert(!have_packet_access<lin::Matrixd<3, 4>, decltype(lin::transpose(lin::Matrixd<4, 3>()))>::value, "");
+static_assert(!have_packet_access<Matrix3x4dc, lin::Matrixd<3, 4>>::value, "");
+
+TEST(CoreTypesLayout, ElementAccess) {
+  Matrix3x4dc A({
+    1.0, 2.0, 3.0, 4.0,
+    5.0, 6.0, 7.0, 8.0,
+    9.0, 10.0, 11.0, 12.0
+  });
+  ASSERT_EQ(3, A.stride());
+  for (lin::size_t i = 0; i < 3; i++) {
+    for (lin::size_t j = 0; j < 4; j++) {
+      ASSERT_DOUBLE_EQ(4.0 * i + j + 1.0, A(i, j));
+      ASSERT_DOUBLE_EQ(4.0 * i + j + 1.0, A(4 * i + j));
+      ASSERT_DOUBLE_EQ(4.0 * i + j + 1.0, A.data()[3 * j + i]);
+    }
+  }
+
+  auto a = lin::col(A, 2);
+  ASSERT_EQ(&A(0, 2), &a(0));
+  ASSERT_EQ(&A(0, 2) + 2, &a(2));
+
+  lin::Matrixd<3, 4> B = A;
+  for (lin::size_t i = 0; i < B.size(); i++) ASSERT_DOUBLE_EQ(A(i), B(i));
+}
+
+TEST(CoreTypesLayout, Assignment) {
+  lin::Matrixd<4, 3> A;
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 2.0;
+
+  Matrix3x4dc B = lin::transpose(A);
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_DOUBLE_EQ(A(i), B.data()[i]);
+
+  Matrix4x3dc C = A;
+  Matrix4x3dc D = C * 2.0 + C - lin::ones<Matrix4x3dc>();
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_DOUBLE_EQ(3.0 * A(i) - 1.0, D(i));
+
+  lin::Matrixd<3, 4> E = lin::transpose(D);
+  for (lin::size_t i = 0; i < 3; i++)
+    for (lin::size_t j = 0; j < 4; j++) ASSERT_DOUBLE_EQ(D(j, i), E(i, j));
+
+  Matrix7x7dac F(5, 6), G(5, 6);
+  for (lin::size_t i = 0; i < F.size(); i++) F(i) = 1.0 + 0.25 * i;
+  ASSERT_EQ(8, F.stride());
+  ASSERT_DOUBLE_EQ(F(1, 2), F.data()[2 * 8 + 1]);
+
+  G = F + F - lin::ones<Matrix7x7dac>(5, 6);
+  for (lin::size_t i = 0; i < G.size(); i++) ASSERT_DOUBLE_EQ(2.0 * F(i) - 1.0, G(i));
+
+  lin::Matrixd<0, 0, 7, 7> H(6, 5);
+  lin::Matrix<double, 0, 0, 7, 7, lin::Storage<32, true>> I(6, 5);
+  H = lin::transpose(G);
+  I = lin::transpose(G);
+  for (lin::size_t i = 0; i < 6; i++) {
+    for (lin::size_t j = 0; j < 5; j++) {
+      ASSERT_DOUBLE_EQ(G(j, i), H(i, j));
+      ASSERT_DOUBLE_EQ(G(j, i), I(i, j));
+    }
+  }
+}
+
+TEST(CoreTypesLayout, Multiply) {
+  Matrix9x9dc A(9, 7), B(7, 8);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 3.0;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 1.0 + 0.25 * i;
+
+  lin::Matrixd<0, 0, 9, 9> C(9, 7), D(7, 8);
+  for (lin::size_t i = 0; i < C.size(); i++) C(i) = A(i);
+  for (lin::size_t i = 0; i < D.size(); i++) D(i) = B(i);
+
+  Matrix9x9dc E = A * B;
+  lin::Matrixd<0, 0, 9, 9> F = C * D;
+  for (lin::size_t i = 0; i < E.size(); i++) ASSERT_DOUBLE_EQ(F(i), E(i));
+
+  Matrix3x4dc G({
+    1.0, 2.0, 3.0, 4.0,
+    5.0, 6.0, 7.0, 8.0,
+    9.0, 10.0, 11.0, 12.0
+  });
+  lin::Vector4d x({1.0, -1.0, 2.0, 0.5});
+  lin::Vector3d y = G * x;
+  ASSERT_DOUBLE_EQ(7.0, y(0));
+  ASSERT_DOUBLE_EQ(17.0, y(1));
+  ASSERT_DOUBLE_EQ(27.0, y(2));
+}
+
+TEST(CoreTypesLayout, ReferencesAndViews) {
+  Matrix4x3dc A = lin::zeros<Matrix4x3dc>();
+  lin::Matrix2x2d B({1.0, 2.0, 3.0, 4.0});
+
+  lin::ref<lin::Matrix2x2d>(A, 1, 1) = B;
+  ASSERT_DOUBLE_EQ(1.0, A(1, 1));
+  ASSERT_DOUBLE_EQ(2.0, A(1, 2));
+  ASSERT_DOUBLE_EQ(3.0, A(2, 1));
+  ASSERT_DOUBLE_EQ(4.0, A(2, 2));
+  ASSERT_DOUBLE_EQ(0.0, A(3, 2));
+
+  double buffer[6] = {1.0, 2.0, 3.0, 4.0, 5.0, 6.0};
+  auto C = lin::view<lin::Matrix<double, 2, 3, 2, 3, lin::ColMajorStorage>>(buffer);
+  static_assert(is_col_major<decltype(C)>::value, "");
+  ASSERT_DOUBLE_EQ(1.0, C(0, 0));
+  ASSERT_DOUBLE_EQ(2.0, C(1, 0));
+  ASSERT_DOUBLE_EQ(3.0, C(0, 1));
+  ASSERT_DOUBLE_EQ(6.0, C(1, 2));
+
+  C = lin::transpose(lin::Matrixd<3, 2>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+  ASSERT_DOUBLE_EQ(1.0, buffer[0]);
+  ASSERT_DOUBLE_EQ(2.0, buffer[1]);
+  ASSERT_DOUBLE_EQ(6.0, buffer[5]);
+}
@@ -3,10 +3,12 @@
 
 // TODO : Test the stream constructor
 
-#include <lin/core/types/matrix.hpp>
+#include <lin/core.hpp>
 
 #include <gtest/gtest.h>
 
+#include <utility>
+
 // Check for constexpr matrix dimensions and zero initialization
 constexpr static lin::Matrix2x2f A;
 static_assert(A.rows() == 2, "");
@@ -17,6 +19,11 @@ static_assert(A(0, 1) == 0.0f, "");
 static_assert(A(1, 0) == 0.0f, "");
 static_assert(A(1, 1) == 0.0f, "");
 
+// Check for constexpr construction from a stream
+constexpr static lin::Matrix2x2f B = lin::transpose(lin::Matrix2x2f({1.0f, 2.0f, 3.0f, 4.0f}));
+static_assert(B(0, 1) == 3.0f, "");
+static_assert(B(1, 0) == 2.0f, "");
+
 TEST(CoreTypesMatrix, MatrixDimensions) {
   lin::Matrixf<3, 5> A;
   ASSERT_EQ(3,  A.rows());
@@ -68,3 +75,30 @@ TEST(CoreTypesMatrix, MatrixResizeListConstructor) {
   ASSERT_FLOAT_EQ(2.0f, A(1, 0));
   ASSERT_FLOAT_EQ(3.0f, A(1, 1));
 }
+
+TEST(CoreTypesMatrix, MatrixCopyConstructor) {
+  lin::Matrixf<0, 0, 4, 4, lin::PaddedStorage> A(3, 2, {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+  lin::Matrixf<0, 0, 4, 4, lin::PaddedStorage> B(A), C(lin::uninitialized, 1, 1);
+  ASSERT_EQ(3, B.rows());
+  ASSERT_EQ(2, B.cols());
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_FLOAT_EQ(A(i), B(i));
+
+  C = A;
+  ASSERT_EQ(3, C.rows());
+  ASSERT_EQ(2, C.cols());
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_FLOAT_EQ(A(i), C(i));
+
+  lin::Matrixf<0, 0, 4, 4, lin::ColMajorStorage> D(3, 2, {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+  lin::Matrixf<0, 0, 4, 4, lin::ColMajorStorage> E(std::move(D));
+  ASSERT_FLOAT_EQ(4.0f, E(2, 0));
+  ASSERT_FLOAT_EQ(3.0f, E(1, 1));
+}
+
+TEST(CoreTypesMatrix, MatrixUninitializedConstructor) {
+  lin::Matrixf<0, 0, 4, 4> A(lin::uninitialized, 2, 3);
+  ASSERT_EQ(2, A.rows());
+  ASSERT_EQ(3, A.cols());
+
+  A = lin::Matrixf<0, 0, 4, 4>(2, 3, {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f});
+  ASSERT_FLOAT_EQ(5.0f, A(1, 2));
+}
@@ -0,0 +1,87 @@
+/** @file test/core/types_packet_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/math.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <type_traits>
+
+using namespace lin::internal;
+
+static_assert(has_packet_access<lin::Matrix3x3d>::value, "");
+static_assert(has_packet_access<lin::Vectorf<0, 7>>::value, "");
+static_assert(has_packet_access<decltype(lin::Matrix3x3d() + lin::Matrix3x3d())>::value, "");
+static_assert(has_packet_access<decltype(lin::zeros<lin::Matrix3x3d>())>::value, "");
+static_assert(has_packet_access<decltype(lin::transpose(lin::Matrix3x3d()))>::value, "");
+static_assert(!have_packet_access<lin::Matrix3x3d, decltype(lin::transpose(lin::Matrix3x3d()))>::value, "");
+static_assert(!has_packet_access<decltype(lin::Matrix3x3d() * lin::Matrix3x3d())>::value, "");
+static_assert(!has_packet_access<decltype(lin::Matrix3x3d() + lin::transpose(lin::Matrix3x3d()))>::value, "");
+
+TEST(CoreTypesPacket, LoadStoreBroadcast) {
+  double a[5] = {1.0, 2.0, 3.0, 4.0, 5.0};
+  float b[3] = {0.0f, 0.0f, 0.0f};
+
+  auto p = packet_load<3>(a + 1);
+  ASSERT_DOUBLE_EQ(2.0, p[0]);
+  ASSERT_DOUBLE_EQ(3.0, p[1]);
+  ASSERT_DOUBLE_EQ(4.0, p[2]);
+
+  packet_store(b, p);
+  ASSERT_FLOAT_EQ(2.0f, b[0]);
+  ASSERT_FLOAT_EQ(3.0f, b[1]);
+  ASSERT_FLOAT_EQ(4.0f, b[2]);
+
+  auto q = packet_broadcast<2>(7.0f);
+  ASSERT_FLOAT_EQ(7.0f, q[0]);
+  ASSERT_FLOAT_EQ(7.0f, q[1]);
+}
+
+TEST(CoreTypesPacket, StreamPacket) {
+  lin::Matrix3x3d A({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  auto p = (A * 2.0 + A).packet<4>(3);
+  ASSERT_DOUBLE_EQ(12.0, p[0]);
+  ASSERT_DOUBLE_EQ(15.0, p[1]);
+  ASSERT_DOUBLE_EQ(18.0, p[2]);
+  ASSERT_DOUBLE_EQ(21.0, p[3]);
+}
+
+TEST(CoreTypesPacket, PacketAssignment) {
+  lin::Matrixd<0, 0, 18, 18> A(17, 13), B(17, 13), C(17, 13);
+  for (lin::size_t i = 0; i < A.size(); i++) {
+    A(i) = 0.5 * i;
+    B(i) = 3.0 - i;
+  }
+
+  C = A * 2.0 - B / 4.0 + lin::ones<decltype(C)>(17, 13);
+  for (lin::size_t i = 0; i < C.size(); i++)
+    ASSERT_DOUBLE_EQ(A(i) * 2.0 - B(i) / 4.0 + 1.0, C(i));
+
+  lin::Vectord<0, 18> d(7);
+  lin::Vectorf<0, 18> e(7), f(7);
+  for (lin::size_t i = 0; i < d.size(); i++) {
+    d(i) = 0.25 * i;
+    e(i) = float(i);
+  }
+
+  f = lin::cast<float>(lin::sqrt(d * 4.0)) + e;
+  for (lin::size_t i = 0; i < f.size(); i++)
+    ASSERT_FLOAT_EQ(float(std::sqrt(double(i))) + float(i), f(i));
+}
+
+TEST(CoreTypesPacket, MixedAssignment) {
+  lin::Matrix4x4f A;
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = float(i);
+
+  lin::Matrix4x4f B = A + lin::transpose(A);
+  for (lin::size_t i = 0; i < 4; i++)
+    for (lin::size_t j = 0; j < 4; j++) ASSERT_FLOAT_EQ(A(i, j) + A(j, i), B(i, j));
+
+  auto c = lin::row(B, 1);
+  c = lin::row(A, 2) * 2.0f;
+  for (lin::size_t j = 0; j < 4; j++) ASSERT_FLOAT_EQ(2.0f * A(2, j), B(1, j));
+}
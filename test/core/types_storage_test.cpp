@@ -0,0 +1,102 @@
+/** @file test/core/types_storage_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using namespace lin::internal;
+
+typedef lin::Matrix<double, 3, 3, 3, 3, lin::Storage<32, true>> Matrix3x3da;
+typedef lin::Matrix<double, 0, 0, 7, 7, lin::Storage<32, true>> Matrix7x7da;
+typedef lin::Vector<double, 3, 3, lin::Storage<32, true>> Vector3da;
+typedef lin::Matrix<float, 4, 4, 4, 4, lin::Storage<64, false>> Matrix4x4fa;
+
+static_assert(lin::Matrix3x3d::Traits::stride == 0, "");
+static_assert(sizeof(lin::Matrix3x3d) == 9 * sizeof(double), "");
+
+static_assert(Matrix3x3da::Traits::stride == 4, "");
+static_assert(alignof(Matrix3x3da) == 32, "");
+static_assert(sizeof(Matrix3x3da) == 12 * sizeof(double), "");
+static_assert(Matrix7x7da::Traits::stride == 8, "");
+static_assert(Vector3da::Traits::stride == 0, "");
+static_assert(sizeof(Vector3da) == 4 * sizeof(double), "");
+static_assert(Matrix4x4fa::Traits::stride == 0, "");
+static_assert(alignof(Matrix4x4fa) == 64, "");
+
+static_assert(is_linearly_addressable<lin::Matrix3x3d>::value, "");
+static_assert(is_linearly_addressable<Vector3da>::value, "");
+static_assert(!is_linearly_addressable<Matrix3x3da>::value, "");
+static_assert(is_linearly_addressable<decltype(lin::Matrix3x3d() + lin::ones<lin::Matrix3x3d>())>::value, "");
+static_assert(!is_linearly_addressable<decltype(lin::Matrix3x3d() + lin::transpose(lin::Matrix3x3d()))>::value, "");
+
+static_assert(have_packet_access<Matrix3x3da, decltype(Matrix3x3da() + lin::ones<Matrix3x3da>())>::value, "");
+static_assert(!have_packet_access<Matrix3x3da, lin::Matrix3x3d>::value, "");
+static_assert(!have_packet_access<decltype(Matrix3x3da() + lin::Matrix3x3d())>::value, "");
+
+TEST(CoreTypesStorage, ElementAccess) {
+  Matrix3x3da A({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  ASSERT_EQ(4, A.stride());
+  ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(A.data()) % 32);
+  for (lin::size_t i = 0; i < 3; i++) {
+    for (lin::size_t j = 0; j < 3; j++) {
+      ASSERT_DOUBLE_EQ(3.0 * i + j + 1.0, A(i, j));
+      ASSERT_DOUBLE_EQ(3.0 * i + j + 1.0, A(3 * i + j));
+      ASSERT_DOUBLE_EQ(3.0 * i + j + 1.0, A.data()[4 * i + j]);
+    }
+  }
+
+  lin::Matrix3x3d B = A;
+  for (lin::size_t i = 0; i < B.size(); i++) ASSERT_DOUBLE_EQ(A(i), B(i));
+  ASSERT_EQ(3, B.stride());
+}
+
+TEST(CoreTypesStorage, Assignment) {
+  Matrix7x7da A(5, 6), B(5, 6), C(5, 6);
+  for (lin::size_t i = 0; i < A.size(); i++) {
+    A(i) = 0.5 * i;
+    B(i) = 2.0 - i;
+  }
+
+  C = A * 2.0 + B - lin::ones<Matrix7x7da>(5, 6);
+  for (lin::size_t i = 0; i < C.size(); i++)
+    ASSERT_DOUBLE_EQ(A(i) * 2.0 + B(i) - 1.0, C(i));
+
+  lin::Matrixd<0, 0, 7, 7> D(5, 6);
+  D = A + lin::transpose(lin::transpose(B));
+  C = D - A;
+  for (lin::size_t i = 0; i < C.size(); i++) ASSERT_DOUBLE_EQ(B(i), C(i));
+
+  Vector3da x({1.0, 2.0, 3.0}), y;
+  y = lin::multiply(x, x) + 1.0;
+  for (lin::size_t i = 0; i < y.size(); i++) ASSERT_DOUBLE_EQ(x(i) * x(i) + 1.0, y(i));
+
+  Matrix4x4fa E;
+  for (lin::size_t i = 0; i < E.size(); i++) E(i) = float(i);
+  E = E * 2.0f;
+  for (lin::size_t i = 0; i < E.size(); i++) ASSERT_FLOAT_EQ(2.0f * i, E(i));
+}
+
+TEST(CoreTypesStorage, Multiply) {
+  Matrix7x7da A(7, 5), B(5, 6);
+  for (lin::size_t i = 0; i < A.size(); i++) A(i) = 0.5 * i - 3.0;
+  for (lin::size_t i = 0; i < B.size(); i++) B(i) = 1.0 + 0.25 * i;
+
+  lin::Matrixd<0, 0, 7, 7> C(7, 5), D(5, 6);
+  C = A;
+  D = B;
+
+  Matrix7x7da E = A * B;
+  lin::Matrixd<0, 0, 7, 7> F = C * D;
+  for (lin::size_t i = 0; i < E.size(); i++) ASSERT_DOUBLE_EQ(F(i), E(i));
+
+  Matrix3x3da G({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0});
+  Vector3da x({1.0, -1.0, 2.0});
+  Vector3da y = G * x;
+  ASSERT_DOUBLE_EQ(5.0, y(0));
+  ASSERT_DOUBLE_EQ(11.0, y(1));
+  ASSERT_DOUBLE_EQ(17.0, y(2));
+}
@@ -0,0 +1,141 @@
+/** @file test/core/types_symmetric_matrix_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/generators/randoms.hpp>
+
+#include <gtest/gtest.h>
+
+#include <utility>
+
+// Check for constexpr dimensions and zero initialization
+constexpr static lin::SymmetricMatrix3x3d S;
+static_assert(S.rows() == 3, "");
+static_assert(S.cols() == 3, "");
+static_assert(S.size() == 9, "");
+static_assert(S.packed_size() == 6, "");
+static_assert(S(0, 2) == 0.0, "");
+
+// Check for constexpr construction from a stream
+constexpr static lin::SymmetricMatrix2x2d T = 2.0 * lin::Matrix2x2d({1.0, 2.0, 2.0, 3.0});
+static_assert(T(0, 1) == 4.0, "");
+static_assert(T(1, 1) == 6.0, "");
+
+static_assert(lin::internal::is_symmetric<lin::SymmetricMatrix3x3d>::value, "");
+static_assert(!lin::internal::is_symmetric<lin::Matrix3x3d>::value, "");
+
+// In place products generally aren't symmetric so they shouldn't compile
+template <class C, class D>
+using multiply_assign_expr = decltype(std::declval<C &>() *= std::declval<D const &>());
+
+static_assert(lin::internal::is_detected<multiply_assign_expr, lin::Matrix3x3d, lin::Matrix3x3d>::value, "");
+static_assert(!lin::internal::is_detected<multiply_assign_expr, lin::SymmetricMatrix3x3d, lin::Matrix3x3d>::value, "");
+static_assert(!lin::internal::is_detected<multiply_assign_expr, lin::SymmetricMatrix3x3d, lin::SymmetricMatrix3x3d>::value, "");
+static_assert(lin::internal::is_detected<multiply_assign_expr, lin::SymmetricMatrix3x3d, double>::value, "");
+
+template <class C, class D>
+static void expect_lower(C const &A, D const &B, double tol) {
+  ASSERT_EQ(A.rows(), B.rows());
+  ASSERT_EQ(A.cols(), B.cols());
+  for (lin::size_t i = 0; i < A.rows(); i++) {
+    for (lin::size_t j = 0; j < A.cols(); j++) {
+      ASSERT_NEAR(A(i, j), B(i, j), tol) << "(" << i << ", " << j << ")";
+      ASSERT_EQ(A(i, j), A(j, i));
+    }
+  }
+}
+
+TEST(CoreTypesSymmetricMatrix, ElementAccess) {
+  lin::SymmetricMatrixd<0, 4> S(3, 3);
+  ASSERT_EQ(3, S.rows());
+  ASSERT_EQ(6, S.packed_size());
+
+  S(0, 1) = 1.0;
+  S(2, 1) = 2.0;
+  S(2, 2) = 3.0;
+  ASSERT_EQ(1.0, S(1, 0));
+  ASSERT_EQ(2.0, S(1, 2));
+  ASSERT_EQ(1.0, S.packed()[1]);
+  ASSERT_EQ(2.0, S.packed()[4]);
+  ASSERT_EQ(3.0, S.packed()[5]);
+  ASSERT_EQ(2.0, S(5));
+  ASSERT_EQ(2.0, S(7));
+
+  // Leading rows and columns are kept on resize
+  S.resize(4, 4);
+  ASSERT_EQ(1.0, S(0, 1));
+  ASSERT_EQ(2.0, S(2, 1));
+
+  lin::SymmetricMatrix2x2d const T({1.0, 2.0, 2.0, 3.0});
+  ASSERT_EQ(2.0, T(0, 1));
+  ASSERT_EQ(3.0, T(1, 1));
+}
+
+TEST(CoreTypesSymmetricMatrix, Assignment) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<5, 5> const A = lin::rands<lin::Matrixd<5, 5>>(rand);
+
+  // Only the lower triangle of the stream is read
+  lin::SymmetricMatrixd<5> S = A;
+  lin::Matrixd<5, 5> L = A;
+  for (lin::size_t i = 0; i < 5; i++)
+    for (lin::size_t j = i + 1; j < 5; j++) L(i, j) = A(j, i);
+  expect_lower(S, L, 0.0);
+
+  // Reading itself element for element doesn't need a temporary
+  S = S + S;
+  expect_lower(S, L + L, 0.0);
+
+  S = lin::consts<lin::Matrixd<5, 5>>(2.0);
+  expect_lower(S, lin::consts<lin::Matrixd<5, 5>>(2.0), 0.0);
+
+  // Stored back into a full matrix
+  lin::Matrixd<5, 5> const B = S;
+  ASSERT_EQ(0.0, lin::fro(B - lin::transpose(B)));
+}
+
+TEST(CoreTypesSymmetricMatrix, Products) {
+  lin::internal::RandomsGenerator rand;
+  {
+    typedef lin::Matrixd<3, 3> M;
+    M const A = lin::rands<M>(rand);
+    lin::SymmetricMatrix3x3d S = A * lin::transpose(A);
+    expect_lower(S, (A * lin::transpose(A)).eval(), 1e-15);
+
+    M const P = S;
+    S = A * S * lin::transpose(A) + S;
+    expect_lower(S, (A * P * lin::transpose(A) + P).eval(), 1e-14);
+  }
+  {
+    typedef lin::Matrixd<0, 0, 40, 40> M;
+    for (lin::size_t n : {1, 7, 18, 37, 40}) {
+      M const A = lin::rands<M>(rand, n, n);
+      lin::SymmetricMatrixd<0, 40> S = A * lin::transpose(A);
+      expect_lower(S, (A * lin::transpose(A)).eval(), 1e-13);
+
+      // The affine addend may be the destination itself
+      M const P = S;
+      S = 2.0 * (A * lin::transpose(A)) + S;
+      expect_lower(S, (2.0 * (A * lin::transpose(A)) + P).eval(), 1e-13);
+    }
+  }
+}
+
+TEST(CoreTypesSymmetricMatrix, Reductions) {
+  lin::internal::RandomsGenerator rand;
+  for (lin::size_t n : {2, 5, 18, 40}) {
+    lin::Matrixd<0, 0, 40, 40> A = lin::rands<lin::Matrixd<0, 0, 40, 40>>(rand, n, n);
+    A = A + lin::transpose(A);
+
+    lin::SymmetricMatrixd<0, 40> const S = A;
+    ASSERT_NEAR(lin::fro(A), lin::fro(S), 1e-12);
+    ASSERT_NEAR(lin::sum(A), lin::sum(S), 1e-12);
+    ASSERT_NEAR(lin::trace(A), lin::trace(S), 1e-12);
+  }
+
+  lin::SymmetricMatrix2x2d const T({1.0, 2.0, 2.0, 3.0});
+  ASSERT_DOUBLE_EQ(18.0, lin::fro(T));
+  ASSERT_DOUBLE_EQ(8.0, lin::sum(T));
+  ASSERT_DOUBLE_EQ(4.0, lin::trace(T));
+}
@@ -129,3 +129,15 @@ TEST(CoreTypesVector, RowVectorResizeListConstructor) {
   ASSERT_FLOAT_EQ(0.0f, u(0));
   ASSERT_FLOAT_EQ(1.0f, u(1));
 }
+
+TEST(CoreTypesVector, VectorUninitializedConstructor) {
+  lin::Vectorf<0, 5> u(lin::uninitialized, 3);
+  lin::RowVectorf<0, 5> v(lin::uninitialized, 2);
+  ASSERT_EQ(3, u.size());
+  ASSERT_EQ(2, v.size());
+
+  u = lin::Vectorf<0, 5>(3, {0.0f, 1.0f, 2.0f});
+  lin::Vectorf<0, 5> w(u);
+  ASSERT_EQ(3, w.size());
+  ASSERT_FLOAT_EQ(2.0f, w(2));
+}
@@ -0,0 +1,143 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+#include <lin/core.hpp>
+#include <lin/dynamic.hpp>
+#include <lin/generators.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <utility>
+
+static_assert(lin::internal::has_dynamic_dimensions<lin::DynamicMatrixd>::value, "");
+static_assert(!lin::internal::has_dynamic_dimensions<lin::Matrixd<0, 0, 9, 9>>::value, "");
+static_assert(std::is_same<lin::DynamicVectord,
+    decltype((std::declval<lin::DynamicMatrixd &>() * std::declval<lin::DynamicVectord &>()).eval())>::value, "");
+static_assert(std::is_same<lin::DynamicRowVectord,
+    decltype(lin::transpose(std::declval<lin::DynamicVectord &>()).eval())>::value, "");
+static_assert(std::is_same<lin::DynamicMatrixd, lin::internal::traits_eval_t<lin::DynamicMatrix<double, lin::ColMajor>>>::value, "");
+
+alignas(64) static unsigned char buffer[1 << 20];
+
+TEST(DynamicArena, Allocate) {
+  lin::Arena arena(buffer, sizeof(buffer));
+  ASSERT_EQ(0, arena.used());
+
+  void *p = arena.allocate(3);
+  void *q = arena.allocate(100);
+  ASSERT_NE(nullptr, p);
+  ASSERT_EQ(0, reinterpret_cast<std::uintptr_t>(q) % lin::arena_alignment);
+  ASSERT_EQ(nullptr, arena.allocate(arena.capacity()));
+
+  // Older allocations are returned once everything above them is freed
+  lin::size_t const used = arena.used();
+  arena.deallocate(p, 3);
+  ASSERT_EQ(used, arena.used());
+  arena.deallocate(q, 100);
+  ASSERT_EQ(0, arena.used());
+
+  // Freed allocations are unwound out of order
+  p = arena.allocate(lin::arena_alignment);
+  q = arena.allocate(2 * lin::arena_alignment);
+  void *r = arena.allocate(3 * lin::arena_alignment);
+  arena.deallocate(p, lin::arena_alignment);
+  arena.deallocate(q, 2 * lin::arena_alignment);
+  ASSERT_EQ(6 * lin::arena_alignment, arena.used());
+  arena.deallocate(r, 3 * lin::arena_alignment);
+  ASSERT_EQ(0, arena.used());
+
+  p = arena.allocate(10);
+  arena.reset();
+  ASSERT_EQ(0, arena.used());
+}
+
+TEST(DynamicArena, MoveAssignment) {
+  lin::Arena arena(buffer, sizeof(buffer));
+  lin::ArenaScope scope(arena);
+
+  lin::DynamicMatrixd A = lin::ones<lin::DynamicMatrixd>(8, 8);
+  lin::DynamicMatrixd B = lin::ones<lin::DynamicMatrixd>(8, 8);
+  lin::DynamicMatrixd C(arena, 8, 8);
+
+  lin::size_t const used = arena.used();
+  for (int i = 0; i < 16; i++) {
+    C = (A * B).eval();
+    ASSERT_EQ(used, arena.used());
+  }
+  ASSERT_DOUBLE_EQ(8.0, C(7, 7));
+
+  // A smaller tensor takes over a larger allocation
+  lin::DynamicMatrixd D(arena, 2, 2);
+  D = (A * B).eval();
+  ASSERT_EQ(8, D.rows());
+  ASSERT_DOUBLE_EQ(8.0, D(0, 0));
+}
+
+TEST(DynamicMatrix, Construction) {
+  lin::Arena arena(buffer, sizeof(buffer));
+  {
+    lin::DynamicMatrixd A(arena, 300, 200);
+    ASSERT_EQ(300, A.rows());
+    ASSERT_EQ(200, A.cols());
+    ASSERT_EQ(&arena, &A.arena());
+    ASSERT_GE(arena.used(), 300 * 200 * sizeof(double));
+    for (lin::size_t i = 0; i < A.size(); i++) ASSERT_DOUBLE_EQ(0.0, A(i));
+
+    lin::DynamicMatrixd B(arena, 2, 3, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+    ASSERT_DOUBLE_EQ(6.0, B(1, 2));
+
+    // Moves hand over the allocation
+    double const *data = B.data();
+    lin::DynamicMatrixd C(std::move(B));
+    ASSERT_EQ(data, C.data());
+    ASSERT_DOUBLE_EQ(4.0, C(1, 0));
+
+    lin::DynamicMatrixd D(C);
+    ASSERT_NE(C.data(), D.data());
+    D(0, 0) = -1.0;
+    ASSERT_DOUBLE_EQ(1.0, C(0, 0));
+
+    D.resize(3, 2);
+    D = lin::transpose(C);
+    ASSERT_DOUBLE_EQ(2.0, D(1, 0));
+  }
+  ASSERT_EQ(0, arena.used());
+}
+
+TEST(DynamicMatrix, Operations) {
+  lin::Arena arena(buffer, sizeof(buffer));
+  lin::ArenaScope scope(arena);
+
+  lin::size_t const n = 40;
+  lin::DynamicMatrixd A(arena, n, n);
+  lin::DynamicVectord x(arena, n);
+  lin::Matrixd<0, 0, n, n> B(n, n);
+  lin::Vectord<0, n> y(n);
+  for (lin::size_t i = 0; i < n; i++) {
+    for (lin::size_t j = 0; j < n; j++) A(i, j) = B(i, j) = 1.0 / (1.0 + i + j);
+    x(i) = y(i) = 0.5 * i - 3.0;
+  }
+
+  // Temporaries come from the default arena
+  lin::DynamicVectord z = A * x - x;
+  lin::Vectord<0, n> w = B * y - y;
+  for (lin::size_t i = 0; i < n; i++) ASSERT_DOUBLE_EQ(w(i), z(i));
+  ASSERT_DOUBLE_EQ(lin::dot(w, w), lin::dot(z, z));
+  ASSERT_DOUBLE_EQ(lin::fro(B), lin::fro(A));
+
+  // Aliased assignment and in place products
+  x = A * x;
+  A *= A;
+  B *= B;
+  for (lin::size_t i = 0; i < n; i++) ASSERT_DOUBLE_EQ(w(i) + y(i), x(i));
+  for (lin::size_t i = 0; i < A.size(); i++) ASSERT_NEAR(B(i), A(i), 1e-12);
+
+  // References and column major storage
+  lin::DynamicMatrix<double, lin::ColMajor> C = lin::transpose(A);
+  lin::col(C, 3) = lin::transpose(lin::row(A, 2));
+  for (lin::size_t i = 0; i < n; i++) {
+    ASSERT_DOUBLE_EQ(A(2, i), C(i, 3));
+    ASSERT_DOUBLE_EQ(A(0, i), C(i, 0));
+  }
+}
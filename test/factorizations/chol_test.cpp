@@ -3,7 +3,9 @@
 
 #include <lin/core.hpp>
 #include <lin/factorizations/chol.hpp>
+#include <lin/generators/identity.hpp>
 #include <lin/generators/randoms.hpp>
+#include <lin/substitutions.hpp>
 
 #include <gtest/gtest.h>
 
@@ -39,3 +41,116 @@ TEST(FactorizationsChol, VariableSizeChol) {
     ASSERT_NEAR(0.0f, lin::fro(M - L), M.size() * 1e-5);
   }
 }
+
+TEST(FactorizationsChol, BlockedChol) {
+  typedef lin::Matrixd<0, 0, 100, 100> Matrix100x100d;
+  typedef lin::Matrix<double, 0, 0, 100, 100, lin::ColMajorStorage> Matrix100x100dc;
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t n : {1, 5, 31, 32, 33, 70, 100}) {
+    Matrix100x100d M = lin::rands<Matrix100x100d>(rand, n, n);
+    zero_above_diagonal(M);
+    for (lin::size_t i = 0; i < n; i++) M(i, i) += 2.0;
+
+    Matrix100x100d L = M * lin::transpose(M);
+    Matrix100x100dc Lc = L;
+    ASSERT_EQ(0, lin::chol(L));
+    ASSERT_EQ(0, lin::chol(Lc));
+    for (lin::size_t i = 0; i < M.size(); i++) {
+      ASSERT_NEAR(M(i), L(i), 1e-10);
+      ASSERT_NEAR(M(i / n, i % n), Lc(i / n, i % n), 1e-10);
+    }
+  }
+}
+
+TEST(FactorizationsChol, PackedChol) {
+  typedef lin::Matrixd<0, 0, 100, 100> Matrix100x100d;
+  typedef lin::SymmetricMatrixd<0, 100> SymmetricMatrix100x100d;
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t n : {1, 5, 18, 33, 100}) {
+    Matrix100x100d M = lin::rands<Matrix100x100d>(rand, n, n);
+    zero_above_diagonal(M);
+    for (lin::size_t i = 0; i < n; i++) M(i, i) += 2.0;
+
+    SymmetricMatrix100x100d L = M * lin::transpose(M);
+    ASSERT_EQ(0, lin::chol(L));
+    for (lin::size_t i = 0; i < n; i++)
+      for (lin::size_t j = 0; j <= i; j++) ASSERT_NEAR(M(i, j), L(i, j), 1e-10);
+
+    // The packed factor's lower triangle feeds the substitutions as is
+    lin::Matrixd<0, 0, 100, 3> const Y = lin::rands<lin::Matrixd<0, 0, 100, 3>>(rand, n, 3);
+    lin::Matrixd<0, 0, 100, 3> X(n, 3), Z(n, 3);
+    ASSERT_EQ(0, lin::forward_sub(L, X, Y));
+    ASSERT_EQ(0, lin::forward_sub(M, Z, Y));
+    ASSERT_NEAR(0.0, lin::fro(X - Z), 1e-16);
+  }
+}
+
+TEST(FactorizationsChol, NonPositivePivot) {
+  lin::Matrixd<0, 0, 40, 40> L(40, 40);
+  L = lin::zeros<decltype(L)>(40, 40);
+  for (lin::size_t i = 0; i < 40; i++) L(i, i) = 1.0;
+  L(35, 35) = -1.0;
+  ASSERT_EQ(36, lin::chol(L));
+
+  // Panels written to the upper triangle as scratch are cleared on failure
+  for (lin::size_t i = 0; i < 40; i++)
+    for (lin::size_t j = 0; j < 40; j++) L(i, j) = (i == j) ? 1.0 : 0.5;
+  L(35, 35) = -1.0;
+  ASSERT_EQ(36, lin::chol(L));
+  for (lin::size_t i = 0; i < 40; i++)
+    for (lin::size_t j = i + 1; j < 40; j++) ASSERT_EQ(0.0, L(i, j));
+
+  lin::Matrix2x2d A({1.0, 2.0, 2.0, 1.0});
+  ASSERT_EQ(2, lin::chol(A));
+
+  lin::SymmetricMatrix2x2d S({1.0, 2.0, 2.0, 1.0});
+  ASSERT_EQ(2, lin::chol(S));
+}
+
+template <class M>
+static void test_chol_update(lin::size_t n) {
+  typedef lin::Matrix<double, 0, 0, M::Traits::max_rows, M::Traits::max_cols> R;
+  typedef lin::Vectord<0, M::Traits::max_rows> V;
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t k = 0; k < 10; k++) {
+    R A = lin::rands<R>(rand, n, n);
+    A = A * lin::transpose(A);
+    for (lin::size_t i = 0; i < n; i++) A(i, i) += 1.0;
+    V const x = lin::rands<V>(rand, n, 1);
+
+    // Factor of A + 4 x x^T from the factor of A
+    M L(n, n), K(n, n);
+    L = A;
+    K = A + 4.0 * x * lin::transpose(x);
+    ASSERT_EQ(0, lin::chol(L));
+    ASSERT_EQ(0, lin::chol(K));
+    ASSERT_EQ(0, lin::chol_update(L, 2.0 * x));
+    for (lin::size_t i = 0; i < n; i++)
+      for (lin::size_t j = 0; j < n; j++) ASSERT_NEAR(K(i, j), L(i, j), 1e-10);
+
+    // And back again
+    K = A;
+    ASSERT_EQ(0, lin::chol(K));
+    ASSERT_EQ(0, lin::chol_downdate(L, 2.0 * x));
+    for (lin::size_t i = 0; i < n; i++)
+      for (lin::size_t j = 0; j < n; j++) ASSERT_NEAR(K(i, j), L(i, j), 1e-8);
+  }
+}
+
+TEST(FactorizationsChol, CholUpdate) {
+  test_chol_update<lin::Matrixd<0, 0, 18, 18>>(18);
+  test_chol_update<lin::Matrixd<0, 0, 18, 18>>(5);
+  test_chol_update<lin::Matrix<double, 0, 0, 18, 18, lin::ColMajorStorage>>(11);
+  test_chol_update<lin::SymmetricMatrixd<0, 18>>(18);
+}
+
+TEST(FactorizationsChol, CholDowndateFailure) {
+  lin::Matrix3x3d L = lin::identity<lin::Matrix3x3d>();
+  ASSERT_EQ(2, lin::chol_downdate(L, lin::Vector3d({0.0, 1.0, 0.0})));
+
+  L = lin::identity<lin::Matrix3x3d>();
+  ASSERT_EQ(1, lin::chol_downdate(L, lin::Vector3d({2.0, 0.0, 0.0})));
+}
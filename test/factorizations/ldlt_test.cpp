@@ -0,0 +1,117 @@
+/** @file test/factorizations/ldlt_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/factorizations/ldlt.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/generators/identity.hpp>
+#include <lin/generators/randoms.hpp>
+
+#include <gtest/gtest.h>
+
+template <lin::size_t N, lin::size_t MN>
+static void test_ldlt(lin::size_t n) {
+  typedef lin::Matrixd<N, N, MN, MN> M;
+  typedef lin::Matrixd<N, 3, MN, 3> V;
+
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t k = 0; k < 10; k++) {
+    M const R = lin::rands<M>(rand, n, n);
+    M const A = R * lin::transpose(R) + lin::identity<M>(n, n);
+
+    M LD = A;
+    ASSERT_EQ(0, lin::ldlt(LD));
+
+    M L = lin::identity<M>(n, n), D = lin::zeros<M>(n, n);
+    for (lin::size_t i = 0; i < n; i++) {
+      D(i, i) = LD(i, i);
+      for (lin::size_t j = 0; j < n; j++) {
+        if (j > i) {
+          ASSERT_EQ(0.0, LD(i, j));
+        }
+        if (j < i) L(i, j) = LD(i, j);
+      }
+    }
+    M const B = L * D * lin::transpose(L);
+    for (lin::size_t i = 0; i < A.size(); i++) ASSERT_NEAR(A(i), B(i), 1e-10);
+
+    V const Y = lin::rands<V>(rand, n, 3);
+    V X;
+    ASSERT_EQ(0, lin::ldlt_solve(LD, X, Y));
+    V const Z = A * X;
+    for (lin::size_t i = 0; i < Y.size(); i++) ASSERT_NEAR(Y(i), Z(i), 1e-10);
+  }
+}
+
+TEST(FactorizationsLdlt, FixedSizeLdlt) {
+  test_ldlt<6, 6>(6);
+}
+
+TEST(FactorizationsLdlt, VariableSizeLdlt) {
+  test_ldlt<0, 15>(15);
+  test_ldlt<0, 15>(9);
+}
+
+TEST(FactorizationsLdlt, SemiDefiniteLdlt) {
+  lin::Matrix3x3d LD({
+    4.0, 2.0, 0.0,
+    2.0, 1.0, 0.0,
+    0.0, 0.0, 3.0
+  });
+  ASSERT_EQ(0, lin::ldlt(LD));
+  ASSERT_DOUBLE_EQ(4.0, LD(0, 0));
+  ASSERT_DOUBLE_EQ(0.0, LD(1, 1));
+  ASSERT_DOUBLE_EQ(3.0, LD(2, 2));
+  ASSERT_DOUBLE_EQ(0.5, LD(1, 0));
+  ASSERT_DOUBLE_EQ(0.0, LD(2, 1));
+
+  lin::Vector3d x;
+  ASSERT_EQ(2, lin::ldlt_solve(LD, x, lin::Vector3d({2.0, 1.0, 3.0})));
+  ASSERT_DOUBLE_EQ(0.5, x(0));
+  ASSERT_DOUBLE_EQ(0.0, x(1));
+  ASSERT_DOUBLE_EQ(1.0, x(2));
+}
+
+TEST(FactorizationsLdlt, NegativePivot) {
+  lin::Matrix2x2d A({1.0, 2.0, 2.0, 1.0});
+  ASSERT_EQ(2, lin::ldlt(A));
+}
+
+TEST(FactorizationsLdlt, RankDeficientLdlt) {
+  typedef lin::Matrixd<12, 12> M;
+  typedef lin::Matrixd<12, 4> N;
+  typedef lin::Vectord<12> V;
+
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t k = 0; k < 10; k++) {
+    // Keep the leading pivots well away from zero as there's no pivoting
+    N B = lin::rands<N>(rand);
+    for (lin::size_t i = 0; i < 4; i++) B(i, i) += 3.0;
+    M const A = B * lin::transpose(B);
+
+    // Rounding leaves the trailing pivots slightly off from zero
+    M LD = A;
+    ASSERT_EQ(0, lin::ldlt(LD));
+
+    lin::size_t rank = 0;
+    M L = lin::identity<M>(), D = lin::zeros<M>();
+    for (lin::size_t i = 0; i < 12; i++) {
+      if (LD(i, i) != 0.0) rank++;
+      D(i, i) = LD(i, i);
+      for (lin::size_t j = 0; j < i; j++) L(i, j) = LD(i, j);
+    }
+    ASSERT_EQ(4, rank);
+
+    M const C = L * D * lin::transpose(L);
+    for (lin::size_t i = 0; i < A.size(); i++) ASSERT_NEAR(A(i), C(i), 1e-10);
+
+    // Right hand sides in the range of the matrix are solved exactly
+    V const Y = A * lin::rands<V>(rand);
+    V X;
+    ASSERT_NE(0, lin::ldlt_solve(LD, X, Y));
+    V const Z = A * X;
+    for (lin::size_t i = 0; i < Y.size(); i++) ASSERT_NEAR(Y(i), Z(i), 1e-10);
+  }
+}
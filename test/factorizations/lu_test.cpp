@@ -0,0 +1,86 @@
+/** @file test/factorizations/lu_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/factorizations/lu.hpp>
+#include <lin/generators/randoms.hpp>
+
+#include <gtest/gtest.h>
+
+template <lin::size_t N, lin::size_t MN, class S = lin::Storage<>>
+static void test_lu(lin::size_t n) {
+  typedef lin::Matrix<double, N, N, MN, MN, S> M;
+  typedef lin::Matrixd<N, 4, MN, 4> V;
+
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t k = 0; k < 10; k++) {
+    M const A = lin::rands<M>(rand, n, n);
+
+    M LU = A;
+    lin::Vector<lin::size_t, N, MN> P;
+    ASSERT_EQ(0, lin::lu(LU, P));
+
+    // Multipliers are bounded by one with partial pivoting
+    for (lin::size_t i = 0; i < n; i++) {
+      ASSERT_LE(i, P(i));
+      for (lin::size_t j = 0; j < i; j++) ASSERT_LE(std::abs(LU(i, j)), 1.0);
+    }
+
+    V const Y = lin::rands<V>(rand, n, 4);
+    V X;
+    ASSERT_EQ(0, lin::lu_solve(LU, P, X, Y));
+    V const Z = A * X;
+    for (lin::size_t i = 0; i < Y.size(); i++) ASSERT_NEAR(Y(i), Z(i), 1e-9);
+
+    lin::Vectord<N, MN> const y = lin::rands<lin::Vectord<N, MN>>(rand, n, 1);
+    lin::Vectord<N, MN> x;
+    ASSERT_EQ(0, lin::lu_solve(LU, P, x, y));
+    lin::Vectord<N, MN> const z = A * x;
+    for (lin::size_t i = 0; i < n; i++) ASSERT_NEAR(y(i), z(i), 1e-9);
+  }
+}
+
+TEST(FactorizationsLu, FixedSizeLu) {
+  test_lu<5, 5>(5);
+}
+
+TEST(FactorizationsLu, VariableSizeLu) {
+  test_lu<0, 40>(40);
+  test_lu<0, 40>(23);
+}
+
+TEST(FactorizationsLu, ColMajorLu) {
+  test_lu<0, 20, lin::ColMajorStorage>(17);
+}
+
+TEST(FactorizationsLu, PivotedLu) {
+  lin::Matrix3x3d LU({
+    0.0, 1.0, 2.0,
+    1.0, 0.0, 3.0,
+    4.0, 5.0, 0.0
+  });
+  lin::Vector<lin::size_t, 3> P;
+  ASSERT_EQ(0, lin::lu(LU, P));
+  ASSERT_EQ(2, P(0));
+  ASSERT_DOUBLE_EQ(4.0, LU(0, 0));
+
+  lin::Vector3d x;
+  ASSERT_EQ(0, lin::lu_solve(LU, P, x, lin::Vector3d({3.0, 4.0, 9.0})));
+  ASSERT_NEAR(1.0, x(0), 1e-14);
+  ASSERT_NEAR(1.0, x(1), 1e-14);
+  ASSERT_NEAR(1.0, x(2), 1e-14);
+}
+
+TEST(FactorizationsLu, SingularLu) {
+  lin::Matrix3x3d LU({
+    1.0, 2.0, 3.0,
+    2.0, 4.0, 6.0,
+    1.0, 0.0, 1.0
+  });
+  lin::Vector<lin::size_t, 3> P;
+  ASSERT_EQ(3, lin::lu(LU, P));
+
+  lin::Vector3d x;
+  ASSERT_EQ(3, lin::lu_solve(LU, P, x, lin::Vector3d({1.0, 2.0, 3.0})));
+}
@@ -2,7 +2,10 @@
  *  @author Kyle Krol */
 
 #include <lin/core.hpp>
+#include <lin/dynamic.hpp>
 #include <lin/factorizations/qr.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/generators/identity.hpp>
 #include <lin/generators/randoms.hpp>
 
 #include <gtest/gtest.h>
@@ -31,3 +34,118 @@ TEST(Factorizations, StaticSizeQr) {
     ASSERT_NEAR(0.0f, lin::fro(M - Q * R), 1e-6 * M.size());
   }
 }
+
+TEST(FactorizationsQr, ColMajorQr) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrix4x3f M;
+  lin::Matrix<float, 4, 3, 4, 3, lin::ColMajorStorage> Q;
+  lin::Matrix3x3f R;
+
+  for (lin::size_t i = 0; i < 25; i++) {
+    M = lin::rands<decltype(M)>(rand, M.rows(), M.cols());
+    ASSERT_EQ(0, lin::qr(M, Q, R));
+    ASSERT_NEAR(0.0f, lin::fro(M - Q * R), 1e-6 * M.size());
+  }
+}
+
+template <lin::size_t M, lin::size_t N, class S = lin::Storage<>>
+static void test_qr_householder(lin::size_t m, lin::size_t n) {
+  typedef lin::Matrix<double, 0, 0, M, N, S> A_t;
+  typedef lin::Matrix<double, 0, 0, M, M> X_t;
+
+  lin::internal::RandomsGenerator rand;
+  A_t const A = lin::rands<A_t>(rand, m, n);
+
+  A_t QR = A;
+  lin::Vectord<0, N> tau;
+  ASSERT_EQ(0, lin::qr_householder(QR, tau));
+  ASSERT_EQ(n, tau.rows());
+
+  // Applying Q to R recovers A
+  A_t B = lin::zeros<A_t>(m, n);
+  for (lin::size_t i = 0; i < n; i++)
+    for (lin::size_t j = i; j < n; j++) B(i, j) = QR(i, j);
+  ASSERT_EQ(0, lin::qr_apply_q(QR, tau, B));
+  for (lin::size_t i = 0; i < m; i++)
+    for (lin::size_t j = 0; j < n; j++) ASSERT_NEAR(A(i, j), B(i, j), 1e-12);
+
+  // Applying Q^T to A recovers R
+  B = A;
+  ASSERT_EQ(0, lin::qr_apply_qt(QR, tau, B));
+  for (lin::size_t i = 0; i < m; i++)
+    for (lin::size_t j = 0; j < n; j++) ASSERT_NEAR((j < i) ? 0.0 : QR(i, j), B(i, j), 1e-12);
+
+  // Q is orthogonal
+  X_t const X = lin::rands<X_t>(rand, m, m);
+  X_t Y = X;
+  ASSERT_EQ(0, lin::qr_apply_qt(QR, tau, Y));
+  ASSERT_EQ(0, lin::qr_apply_q(QR, tau, Y));
+  for (lin::size_t i = 0; i < X.size(); i++) ASSERT_NEAR(X(i), Y(i), 1e-12);
+
+  // Least squares residuals are orthogonal to the columns of A
+  lin::Vectord<0, M> const b = lin::rands<lin::Vectord<0, M>>(rand, m, 1);
+  lin::Vectord<0, N> x;
+  ASSERT_EQ(0, lin::qr_solve(QR, tau, x, b));
+  lin::Vectord<0, N> const g = lin::transpose(A) * (A * x - b);
+  for (lin::size_t i = 0; i < n; i++) ASSERT_NEAR(0.0, g(i), 1e-10);
+}
+
+TEST(FactorizationsQr, HouseholderQr) {
+  test_qr_householder<4, 3>(4, 3);
+  test_qr_householder<9, 8>(8, 6);
+  test_qr_householder<9, 8, lin::ColMajorStorage>(9, 8);
+}
+
+TEST(FactorizationsQr, BlockedHouseholderQr) {
+  test_qr_householder<60, 40>(60, 40);
+  test_qr_householder<60, 40>(53, 33);
+  test_qr_householder<60, 40, lin::ColMajorStorage>(48, 32);
+}
+
+TEST(FactorizationsQr, BlockedQr) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<0, 0, 50, 40> M, Q;
+  lin::Matrixd<0, 0, 40, 40> R;
+
+  M.resize(50, 37);
+  M = lin::rands<decltype(M)>(rand, M.rows(), M.cols());
+  ASSERT_EQ(0, lin::qr(M, Q, R));
+  ASSERT_NEAR(0.0, lin::fro(M - Q * R), 1e-20);
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(Q) * Q - lin::identity<decltype(R)>(37, 37)), 1e-20);
+  for (lin::size_t i = 0; i < R.rows(); i++) {
+    ASSERT_LE(0.0, R(i, i));
+    for (lin::size_t j = 0; j < i; j++) ASSERT_EQ(0.0, R(i, j));
+  }
+}
+
+TEST(FactorizationsQr, DynamicQr) {
+  alignas(64) static unsigned char buffer[1 << 20];
+  lin::Arena arena(buffer, sizeof(buffer));
+  lin::ArenaScope scope(arena);
+
+  lin::internal::RandomsGenerator rand;
+  lin::DynamicMatrixd const M = lin::rands<lin::DynamicMatrixd>(rand, 50, 37);
+  lin::DynamicMatrixd Q(arena, 50, 37), R(arena, 37, 37);
+
+  lin::size_t const used = arena.used();
+  ASSERT_EQ(0, lin::qr(M, Q, R));
+  ASSERT_EQ(used, arena.used());
+  ASSERT_NEAR(0.0, lin::fro(M - Q * R), 1e-20);
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(Q) * Q - lin::identity<lin::DynamicMatrixd>(37, 37)), 1e-20);
+}
+
+TEST(FactorizationsQr, RankDeficientQrSolve) {
+  lin::Matrix3x2d QR({
+    1.0, 0.0,
+    1.0, 0.0,
+    0.0, 0.0
+  });
+  lin::Vector2d tau;
+  ASSERT_EQ(0, lin::qr_householder(QR, tau));
+  ASSERT_DOUBLE_EQ(0.0, tau(1));
+
+  lin::Vector2d x;
+  ASSERT_EQ(2, lin::qr_solve(QR, tau, x, lin::Vector3d({1.0, 3.0, 5.0})));
+  ASSERT_NEAR(2.0, x(0), 1e-14);
+  ASSERT_DOUBLE_EQ(0.0, x(1));
+}
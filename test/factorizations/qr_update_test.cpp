@@ -0,0 +1,197 @@
+/** @file test/factorizations/qr_update_test.cpp
+ *  @author Kyle Krol */
+
+#include <lin/core.hpp>
+#include <lin/dynamic.hpp>
+#include <lin/factorizations/qr.hpp>
+#include <lin/factorizations/qr_update.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/generators/identity.hpp>
+#include <lin/generators/randoms.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+typedef lin::Matrixd<0, 0, 12, 8> Matrix12x8d;
+typedef lin::Matrixd<0, 0, 8, 8> Matrix8x8d;
+
+/* Checks Q R reproduces A, Q has orthonormal columns, and R is exactly upper
+ * triangular.
+ */
+template <class M, class N>
+static void expect_qr(Matrix12x8d const &A, M const &Q, N const &R) {
+  ASSERT_EQ(A.rows(), Q.rows());
+  ASSERT_EQ(A.cols(), Q.cols());
+  ASSERT_EQ(A.cols(), R.rows());
+  ASSERT_EQ(A.cols(), R.cols());
+
+  ASSERT_NEAR(0.0, lin::fro(A - Q * R), 1e-20);
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(Q) * Q - lin::identity<Matrix8x8d>(R.rows(), R.cols())), 1e-20);
+  for (lin::size_t i = 0; i < R.rows(); i++)
+    for (lin::size_t j = 0; j < i; j++) ASSERT_EQ(0.0, R(i, j));
+}
+
+/* Checks R^T R matches A^T A.
+ */
+static void expect_r(Matrix12x8d const &A, Matrix8x8d const &R) {
+  ASSERT_EQ(A.cols(), R.rows());
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(R) * R - lin::transpose(A) * A), 1e-18);
+  for (lin::size_t i = 0; i < R.rows(); i++)
+    for (lin::size_t j = 0; j < i; j++) ASSERT_EQ(0.0, R(i, j));
+}
+
+TEST(FactorizationsQrUpdate, AppendDeleteRow) {
+  lin::internal::RandomsGenerator rand;
+  Matrix12x8d A = lin::rands<Matrix12x8d>(rand, 9, 6), Q;
+  Matrix8x8d R;
+  ASSERT_EQ(0, lin::qr(A, Q, R));
+
+  // Append two rows
+  for (lin::size_t k = 0; k < 2; k++) {
+    lin::RowVectord<0, 8> const a = lin::rands<lin::RowVectord<0, 8>>(rand, 1, 6);
+    ASSERT_EQ(0, lin::qr_append_row(Q, R, a));
+    A.resize(A.rows() + 1, A.cols());
+    for (lin::size_t j = 0; j < A.cols(); j++) A(A.rows() - 1, j) = a(j);
+    expect_qr(A, Q, R);
+  }
+
+  // Delete the first, a middle, and the last row
+  for (lin::size_t k : {0, 4, 8}) {
+    ASSERT_EQ(0, lin::qr_delete_row(Q, R, k));
+    for (lin::size_t i = k; i + 1 < A.rows(); i++)
+      for (lin::size_t j = 0; j < A.cols(); j++) A(i, j) = A(i + 1, j);
+    A.resize(A.rows() - 1, A.cols());
+    expect_qr(A, Q, R);
+  }
+}
+
+TEST(FactorizationsQrUpdate, DynamicAppendDeleteRow) {
+  alignas(64) static unsigned char buffer[1 << 20];
+  lin::Arena arena(buffer, sizeof(buffer));
+  lin::ArenaScope scope(arena);
+
+  lin::internal::RandomsGenerator rand;
+  lin::DynamicMatrixd A = lin::rands<lin::DynamicMatrixd>(rand, 9, 6);
+  lin::DynamicMatrixd Q(arena, 9, 6), R(arena, 6, 6);
+  ASSERT_EQ(0, lin::qr(A, Q, R));
+
+  lin::DynamicRowVectord const a = lin::rands<lin::DynamicRowVectord>(rand, 1, 6);
+  ASSERT_EQ(0, lin::qr_append_row(Q, R, a));
+  ASSERT_EQ(10, Q.rows());
+  for (lin::size_t j = 0; j < 6; j++) ASSERT_NEAR(a(j), (lin::row(Q, 9) * R)(j), 1e-14);
+
+  ASSERT_EQ(0, lin::qr_delete_row(Q, R, 9));
+  ASSERT_EQ(9, Q.rows());
+  ASSERT_NEAR(0.0, lin::fro(A - Q * R), 1e-20);
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(Q) * Q - lin::identity<lin::DynamicMatrixd>(6, 6)), 1e-20);
+
+  lin::DynamicVectord const b = lin::rands<lin::DynamicVectord>(rand, 9, 1);
+  ASSERT_EQ(0, lin::qr_append_col(Q, R, b));
+  ASSERT_EQ(7, R.rows());
+  for (lin::size_t i = 0; i < 9; i++) ASSERT_NEAR(b(i), (Q * lin::col(R, 6))(i), 1e-14);
+
+  ASSERT_EQ(0, lin::qr_delete_col(Q, R, 6));
+  ASSERT_EQ(6, R.rows());
+  ASSERT_NEAR(0.0, lin::fro(A - Q * R), 1e-20);
+}
+
+TEST(FactorizationsQrUpdate, AppendDeleteCol) {
+  lin::internal::RandomsGenerator rand;
+  Matrix12x8d A = lin::rands<Matrix12x8d>(rand, 10, 5), Q;
+  Matrix8x8d R;
+  ASSERT_EQ(0, lin::qr(A, Q, R));
+
+  // Append two columns
+  for (lin::size_t k = 0; k < 2; k++) {
+    lin::Vectord<0, 12> const a = lin::rands<lin::Vectord<0, 12>>(rand, 10, 1);
+    ASSERT_EQ(0, lin::qr_append_col(Q, R, a));
+    Matrix12x8d B = A;
+    A.resize(A.rows(), A.cols() + 1);
+    for (lin::size_t i = 0; i < A.rows(); i++) {
+      for (lin::size_t j = 0; j + 1 < A.cols(); j++) A(i, j) = B(i, j);
+      A(i, A.cols() - 1) = a(i);
+    }
+    expect_qr(A, Q, R);
+  }
+
+  // Linearly dependent columns
+  lin::Vectord<0, 12> const a = lin::col(A, 0) + lin::col(A, 2);
+  lin::qr_append_col(Q, R, a);
+  ASSERT_NEAR(0.0, R(7, 7), 1e-14);
+  ASSERT_EQ(0, lin::qr_delete_col(Q, R, 7));
+  ASSERT_EQ(8, lin::qr_append_col(Q, R, lin::zeros<lin::Vectord<0, 12>>(10, 1)));
+  ASSERT_EQ(0.0, R(7, 7));
+  ASSERT_EQ(0, lin::qr_delete_col(Q, R, 7));
+
+  // Delete the first, a middle, and the last column
+  for (lin::size_t k : {0, 3, 4}) {
+    ASSERT_EQ(0, lin::qr_delete_col(Q, R, k));
+    Matrix12x8d B = A;
+    A.resize(A.rows(), A.cols() - 1);
+    for (lin::size_t i = 0; i < A.rows(); i++)
+      for (lin::size_t j = 0; j < A.cols(); j++) A(i, j) = B(i, j + (j >= k));
+    expect_qr(A, Q, R);
+  }
+}
+
+TEST(FactorizationsQrUpdate, TriangularFactorOnly) {
+  lin::internal::RandomsGenerator rand;
+  Matrix12x8d A = lin::rands<Matrix12x8d>(rand, 9, 6), Q;
+  Matrix8x8d R;
+  ASSERT_EQ(0, lin::qr(A, Q, R));
+
+  lin::Vectord<0, 8> const a = lin::rands<lin::Vectord<0, 8>>(rand, 6, 1);
+  ASSERT_EQ(0, lin::qr_append_row(R, a));
+  A.resize(10, 6);
+  for (lin::size_t j = 0; j < 6; j++) A(9, j) = a(j);
+  expect_r(A, R);
+
+  // Delete the row just appended and then the first row
+  ASSERT_EQ(0, lin::qr_delete_row(R, a));
+  A.resize(9, 6);
+  expect_r(A, R);
+
+  lin::RowVectord<0, 8> const b = lin::row(A, 0);
+  ASSERT_EQ(0, lin::qr_delete_row(R, b));
+  for (lin::size_t i = 0; i < 8; i++)
+    for (lin::size_t j = 0; j < 6; j++) A(i, j) = A(i + 1, j);
+  A.resize(8, 6);
+  expect_r(A, R);
+
+  ASSERT_EQ(0, lin::qr_delete_col(R, 2));
+  Matrix12x8d const B = A;
+  A.resize(8, 5);
+  for (lin::size_t i = 0; i < 8; i++)
+    for (lin::size_t j = 0; j < 5; j++) A(i, j) = B(i, j + (j >= 2));
+  expect_r(A, R);
+}
+
+TEST(FactorizationsQrUpdate, DeleteRowFailure) {
+  lin::Matrix2x2d R = lin::identity<lin::Matrix2x2d>();
+  ASSERT_EQ(2, lin::qr_delete_row(R, lin::RowVector2d({0.0, 1.0})));
+
+  // Only the last row has a nonzero second column
+  lin::Matrixd<0, 0, 3, 2> const A(3, 2, {
+    1.0, 0.0,
+    1.0, 0.0,
+    0.0, 1.0
+  });
+  lin::Matrixd<0, 0, 3, 2> Q(3, 2);
+  lin::Matrixd<0, 0, 2, 2> S(2, 2);
+  ASSERT_EQ(0, lin::qr(A, Q, S));
+  lin::Matrixd<0, 0, 3, 2> const P = Q;
+  ASSERT_EQ(3, lin::qr_delete_row(Q, S, 2));
+  ASSERT_EQ(3, Q.rows());
+  for (lin::size_t i = 0; i < P.size(); i++) ASSERT_EQ(P(i), Q(i));
+}
+
+TEST(FactorizationsQrUpdate, ExtremeScales) {
+  for (double x : {1e-200, 1e200}) {
+    lin::Matrix2x2d R = x * lin::identity<lin::Matrix2x2d>();
+    ASSERT_EQ(0, lin::qr_append_row(R, lin::RowVector2d({x, 0.0})));
+    ASSERT_NEAR(std::sqrt(2.0), R(0, 0) / x, 1e-15);
+    ASSERT_NEAR(1.0, R(1, 1) / x, 1e-15);
+    ASSERT_EQ(0.0, R(1, 0));
+  }
+}
@@ -3,6 +3,7 @@
 
 #include <lin/core.hpp>
 #include <lin/generators/constants.hpp>
+#include <lin/references.hpp>
 
 #include <gtest/gtest.h>
 
@@ -60,3 +61,15 @@ TEST(GeneratorsConstants, Nans) {
   for (size_t i = 0; i < A.rows(); i++)
     for (size_t j = 0; j < A.cols(); j++) ASSERT_TRUE(std::isnan(A(i, j)));
 }
+
+TEST(GeneratorsConstants, Fill) {
+  lin::Matrix<double, 0, 0, 7, 7, lin::PaddedStorage> A(5, 3);
+  A = lin::ones<decltype(A)>(5, 3);
+  for (size_t i = 0; i < A.size(); i++) ASSERT_DOUBLE_EQ(1.0, A(i));
+
+  lin::Matrixd<4, 4> B = lin::ones<lin::Matrixd<4, 4>>();
+  lin::ref<lin::Matrixd<2, 3>>(B, 1, 1) = lin::zeros<lin::Matrixd<2, 3>>();
+  for (size_t i = 0; i < B.rows(); i++)
+    for (size_t j = 0; j < B.cols(); j++)
+      ASSERT_DOUBLE_EQ((i == 1 || i == 2) && j > 0 ? 0.0 : 1.0, B(i, j));
+}
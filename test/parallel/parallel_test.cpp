@@ -0,0 +1,146 @@
+// vim: set tabstop=2:softtabstop=2:shiftwidth=2:expandtab
+
+// Exercise the worker threads regardless of the host's core count
+#define LIN_PARALLEL_THREADS 4
+
+#include <lin/core.hpp>
+#include <lin/generators/constants.hpp>
+#include <lin/generators/randoms.hpp>
+#include <lin/math.hpp>
+#include <lin/parallel.hpp>
+#include <lin/references.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+typedef lin::Matrix<double, 0, 0, 256, 256> Matrixd;
+typedef lin::Matrix<double, 0, 0, 256, 256, lin::PaddedStorage> Matrixdp;
+typedef lin::Matrix<double, 0, 0, 256, 256, lin::ColMajorStorage> Matrixdc;
+
+template <class M>
+static void test_element_wise(lin::size_t r, lin::size_t c) {
+  static M A, B, X, Y;
+  lin::internal::RandomsGenerator rand;
+  for (M *m : {&A, &B, &X, &Y}) m->resize(r, c);
+  A = lin::rands<M>(rand, r, c);
+  B = lin::rands<M>(rand, r, c);
+
+  X = lin::sin(A) + 2.0 * B - A / 3.0;
+  lin::parallel(Y) = lin::sin(A) + 2.0 * B - A / 3.0;
+  ASSERT_EQ(r, Y.rows());
+  ASSERT_EQ(c, Y.cols());
+  ASSERT_EQ(0, std::memcmp(X.data(), Y.data(), sizeof(double) * X.size()));
+  for (lin::size_t i = 0; i < X.size(); i++) ASSERT_EQ(X(i), Y(i));
+}
+
+TEST(Parallel, ThreadPool) {
+  std::vector<std::atomic<int>> counts(1000);
+  for (auto &count : counts) count = 0;
+
+  lin::internal::thread_pool().run(counts.size(), [&](lin::size_t t) {
+    counts[t]++;
+    // Nested runs are executed inline
+    lin::internal::thread_pool().run(2, [&](lin::size_t) { });
+  });
+  for (auto const &count : counts) ASSERT_EQ(1, count);
+}
+
+TEST(Parallel, ElementWise) {
+  test_element_wise<Matrixd>(256, 256);
+  test_element_wise<Matrixd>(201, 253);
+  test_element_wise<Matrixdp>(256, 256);
+  test_element_wise<Matrixdp>(199, 203);
+  test_element_wise<Matrixdc>(201, 253);
+  test_element_wise<Matrixd>(3, 5);
+}
+
+TEST(Parallel, References) {
+  static Matrixd A, B;
+  lin::internal::RandomsGenerator rand;
+  A = lin::rands<Matrixd>(rand, 256, 256);
+  B = lin::zeros<Matrixd>(256, 256);
+
+  lin::parallel(lin::ref<lin::Matrix<double, 0, 0, 256, 256>>(B, 1, 2, 200, 250)) =
+      lin::ref<lin::Matrix<double, 0, 0, 256, 256>>(A, 0, 0, 200, 250);
+  for (lin::size_t i = 0; i < 256; i++)
+    for (lin::size_t j = 0; j < 256; j++)
+      ASSERT_EQ((i > 0 && i < 201 && j > 1 && j < 252) ? A(i - 1, j - 2) : 0.0, B(i, j));
+}
+
+TEST(Parallel, Aliasing) {
+  static Matrixd A, B, X;
+  lin::internal::RandomsGenerator rand;
+  A = lin::rands<Matrixd>(rand, 200, 200);
+  B = lin::rands<Matrixd>(rand, 200, 200);
+  X.resize(200, 200);
+
+  // Positional aliasing is safe to split
+  X = A;
+  lin::parallel(X) = X + B;
+  for (lin::size_t i = 0; i < X.size(); i++) ASSERT_EQ(A(i) + B(i), X(i));
+
+  // Non positional aliasing falls back to a temporary
+  X = A;
+  lin::parallel(X) = lin::transpose(X);
+  for (lin::size_t i = 0; i < 200; i++)
+    for (lin::size_t j = 0; j < 200; j++) ASSERT_EQ(A(j, i), X(i, j));
+}
+
+template <typename T>
+static void test_products(lin::size_t m, lin::size_t n, lin::size_t k) {
+  typedef lin::Matrix<T, 0, 0, 320, 320> M;
+  static M A, B, X, Y;
+  lin::internal::RandomsGenerator rand;
+  for (M *x : {&X, &Y}) x->resize(m, n);
+  A = lin::rands<M>(rand);
+  B = lin::rands<M>(rand);
+  auto const Ar = lin::ref<M>(A, 0, 0, m, k);
+  auto const Br = lin::ref<M>(B, 0, 0, k, n);
+
+  X = Ar * Br;
+  lin::parallel(Y) = Ar * Br;
+  ASSERT_EQ(0, std::memcmp(X.data(), Y.data(), sizeof(T) * X.size()));
+
+  X = T(2) * Ar * lin::transpose(lin::ref<M>(B, 0, 0, n, k));
+  lin::parallel(Y) = T(2) * Ar * lin::transpose(lin::ref<M>(B, 0, 0, n, k));
+  ASSERT_EQ(0, std::memcmp(X.data(), Y.data(), sizeof(T) * X.size()));
+}
+
+TEST(Parallel, SymmetricProducts) {
+  typedef lin::SymmetricMatrix<double, 0, 256> S;
+  static Matrixd A, B;
+  static S X, Y;
+  lin::internal::RandomsGenerator rand;
+
+  for (lin::size_t n : {37, 200, 256}) {
+    A = lin::rands<Matrixd>(rand, n, 150);
+    X.resize(n, n);
+    Y.resize(n, n);
+    B.resize(n, n);
+    B = A * lin::transpose(A);
+
+    X = A * lin::transpose(A);
+    lin::parallel(Y) = A * lin::transpose(A);
+    for (lin::size_t i = 0; i < n; i++) {
+      for (lin::size_t j = 0; j <= i; j++) {
+        ASSERT_EQ(B(i, j), X(i, j));
+        ASSERT_EQ(B(i, j), Y(i, j));
+      }
+    }
+
+    lin::parallel(Y) = Y + X;
+    for (lin::size_t i = 0; i < n; i++)
+      for (lin::size_t j = 0; j <= i; j++) ASSERT_EQ(B(i, j) + B(i, j), Y(i, j));
+  }
+}
+
+TEST(Parallel, Products) {
+  test_products<double>(150, 140, 130);
+  test_products<double>(203, 157, 301);
+  test_products<double>(320, 320, 320);
+  test_products<float>(203, 157, 301);
+  test_products<double>(3, 5, 7);
+}
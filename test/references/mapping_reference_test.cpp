@@ -9,6 +9,12 @@
 
 #include <type_traits>
 
+using lin::internal::is_linearly_addressable;
+
+static_assert(!is_linearly_addressable<decltype(lin::ref<lin::Matrix2x2f>(std::declval<lin::Matrix3x3f &>(), 0, 0))>::value, "");
+static_assert(is_linearly_addressable<decltype(lin::col(std::declval<lin::Matrix3x3f &>(), 0))>::value, "");
+static_assert(is_linearly_addressable<decltype(lin::row(std::declval<lin::Matrix3x3f &>(), 0))>::value, "");
+
 TEST(MappingReference, MatrixMappingReference) {
   lin::Matrix3x3f A = {
     0.0f, 1.0f, 2.0f,
@@ -148,3 +154,26 @@ TEST(MappingReference, DiagonalMappingReference) {
   d(1) = 4.0f;
   ASSERT_FLOAT_EQ(4.0f, B(1, 1));
 }
+
+TEST(MappingReference, CompoundAssignment) {
+  lin::Matrix3x3f A = {
+    0.0f, 1.0f, 2.0f,
+    3.0f, 4.0f, 5.0f,
+    6.0f, 7.0f, 8.0f
+  };
+
+  lin::col(A, 1) -= lin::col(A, 0);
+  ASSERT_FLOAT_EQ(1.0f, A(0, 1));
+  ASSERT_FLOAT_EQ(1.0f, A(1, 1));
+  ASSERT_FLOAT_EQ(1.0f, A(2, 1));
+
+  lin::row(A, 2) *= 0.5f;
+  ASSERT_FLOAT_EQ(3.0f, A(2, 0));
+  ASSERT_FLOAT_EQ(4.0f, A(2, 2));
+
+  lin::ref<lin::Matrix2x2f>(A, 1, 1) *= lin::Matrix2x2f({0.0f, 1.0f, 1.0f, 0.0f});
+  ASSERT_FLOAT_EQ(5.0f, A(1, 1));
+  ASSERT_FLOAT_EQ(1.0f, A(1, 2));
+  ASSERT_FLOAT_EQ(4.0f, A(2, 1));
+  ASSERT_FLOAT_EQ(0.5f, A(2, 2));
+}
@@ -67,3 +67,43 @@ TEST(SubstitutionsBackwardSubstitution, StaticSizeVectorBackwardSubstituion) {
     ASSERT_NEAR(0.0f, lin::fro(M * X - Y), 1e-6 * Y.size());
   }
 }
+
+TEST(SubstitutionsBackwardSubstitution, BlockedBackwardSubstitution) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<0, 0, 80, 80> U;
+  lin::Matrixd<0, 0, 80, 21> X, Y;
+
+  for (lin::size_t n : {7, 32, 75}) {
+    U = lin::rands<decltype(U)>(rand, n, n);
+    for (lin::size_t i = 0; i < n; i++) {
+      U(i, i) = U(i, i) + 4.0;
+      for (lin::size_t j = 0; j < i; j++) U(i, j) = 0.0;
+    }
+    Y = lin::rands<decltype(Y)>(rand, n, 21);
+
+    ASSERT_EQ(0, lin::backward_sub(U, X, Y));
+    ASSERT_NEAR(0.0, lin::fro(U * X - Y), 1e-20);
+
+    // Solving in place gives the same result
+    lin::Matrixd<0, 0, 80, 21> Z = Y;
+    ASSERT_EQ(0, lin::backward_sub(U, Z, Z));
+    for (lin::size_t i = 0; i < X.size(); i++) ASSERT_DOUBLE_EQ(X(i), Z(i));
+  }
+}
+
+TEST(SubstitutionsBackwardSubstitution, TransposedBackwardSubstitution) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrix<double, 0, 0, 40, 40, lin::ColMajorStorage> L;
+  lin::Matrixd<0, 0, 40, 3> X, Y;
+
+  L.resize(37, 37);
+  L = lin::rands<lin::Matrixd<0, 0, 40, 40>>(rand, 37, 37);
+  for (lin::size_t i = 0; i < L.rows(); i++) {
+    L(i, i) = L(i, i) + 4.0;
+    for (lin::size_t j = i + 1; j < L.cols(); j++) L(i, j) = 0.0;
+  }
+  Y = lin::rands<decltype(Y)>(rand, 37, 3);
+
+  ASSERT_EQ(0, lin::backward_sub_transposed(L, X, Y));
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(L) * X - Y), 1e-20);
+}
@@ -90,3 +90,67 @@ TEST(SubstitutionsFowardSubstitutions, VariableSizeVectorForwardSubstitution) {
     ASSERT_NEAR(0.0f, lin::fro(M * X - Z), 1e-5 * Y.size());
   }
 }
+
+TEST(SubstitutionsFowardSubstitutions, BlockedFowardSubstitution) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<0, 0, 80, 80> L;
+  lin::Matrixd<0, 0, 80, 21> X, Y;
+
+  for (lin::size_t n : {7, 32, 75}) {
+    L = lin::rands<decltype(L)>(rand, n, n);
+    for (lin::size_t i = 0; i < n; i++) L(i, i) = L(i, i) + 4.0;
+    zero_above_diagonal(L);
+    Y = lin::rands<decltype(Y)>(rand, n, 21);
+
+    ASSERT_EQ(0, lin::forward_sub(L, X, Y));
+    ASSERT_NEAR(0.0, lin::fro(L * X - Y), 1e-20);
+
+    // Solving in place gives the same result
+    lin::Matrixd<0, 0, 80, 21> Z = Y;
+    ASSERT_EQ(0, lin::forward_sub(L, Z, Z));
+    for (lin::size_t i = 0; i < X.size(); i++) ASSERT_DOUBLE_EQ(X(i), Z(i));
+  }
+}
+
+TEST(SubstitutionsFowardSubstitutions, TransposedFowardSubstitution) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<0, 0, 40, 40> U;
+  lin::Vectord<0, 40> x, y;
+
+  U = lin::rands<decltype(U)>(rand, 37, 37);
+  for (lin::size_t i = 0; i < U.rows(); i++) {
+    U(i, i) = U(i, i) + 4.0;
+    for (lin::size_t j = 0; j < i; j++) U(i, j) = 0.0;
+  }
+  y = lin::rands<decltype(y)>(rand, 37, 1);
+
+  ASSERT_EQ(0, lin::forward_sub_transposed(U, x, y));
+  ASSERT_NEAR(0.0, lin::fro(lin::transpose(U) * x - y), 1e-20);
+}
+
+TEST(SubstitutionsFowardSubstitutions, CholeskySolve) {
+  lin::internal::RandomsGenerator rand;
+  lin::Matrixd<0, 0, 50, 50> M, L;
+  lin::Matrixd<0, 0, 50, 4> X;
+
+  M = lin::rands<decltype(M)>(rand, 50, 50);
+  L = M * lin::transpose(M);
+  M = L;
+  X = lin::rands<decltype(X)>(rand, 50, 4);
+  lin::Matrixd<0, 0, 50, 4> const Y = X;
+
+  ASSERT_EQ(0, lin::chol(L));
+  ASSERT_EQ(0, lin::forward_sub(L, X, X));
+  ASSERT_EQ(0, lin::backward_sub_transposed(L, X, X));
+  ASSERT_NEAR(0.0, lin::fro(M * X - Y), 1e-12);
+}
+
+TEST(SubstitutionsFowardSubstitutions, SingularFowardSubstitution) {
+  lin::Matrix3x3d L({
+    1.0, 0.0, 0.0,
+    2.0, 0.0, 0.0,
+    3.0, 4.0, 5.0
+  });
+  lin::Vector3d x, y({1.0, 2.0, 3.0});
+  ASSERT_EQ(2, lin::forward_sub(L, x, y));
+}